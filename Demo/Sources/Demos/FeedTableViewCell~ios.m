@@ -24,11 +24,62 @@
 
 @implementation FeedTableViewCell
 
+#pragma mark Object lifecycle
+
+- (void)dealloc
+{
+    self.letterboxController = nil;
+}
+
+#pragma mark Class methods
+
++ (SRGLetterboxControllerPool *)controllerPool
+{
+    static SRGLetterboxControllerPool *s_controllerPool;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        s_controllerPool = [[SRGLetterboxControllerPool alloc] initWithCapacity:8 configurationBlock:^(SRGLetterboxController * _Nonnull controller) {
+            controller.serviceURL = ApplicationSettingServiceURL();
+            controller.updateInterval = ApplicationSettingUpdateInterval();
+            controller.globalParameters = ApplicationSettingGlobalParameters();
+            controller.backgroundVideoPlaybackEnabled = ApplicationSettingIsBackgroundVideoPlaybackEnabled();
+            controller.muted = YES;
+            controller.resumesAfterRouteBecomesUnavailable = YES;
+            controller.subtitleConfigurationBlock = nil;
+        }];
+    });
+    return s_controllerPool;
+}
+
 #pragma mark Getters and setters
 
+- (void)setLetterboxController:(SRGLetterboxController *)letterboxController
+{
+    if (_letterboxController) {
+        [_letterboxController removePeriodicTimeObserver:self.periodicTimeObserver];
+        [FeedTableViewCell.controllerPool recycleController:_letterboxController];
+    }
+    
+    _letterboxController = letterboxController;
+    
+    // Controllers given back to the pool are left attached to the view, so that attaching the same controller again
+    // is cheap
+    if (letterboxController) {
+        self.letterboxView.controller = letterboxController;
+        
+        if (self.window) {
+            [self addPeriodicTimeObserver];
+        }
+    }
+}
+
 - (void)setMedia:(SRGMedia *)media withPreferredSubtitleLocalization:(NSString *)preferredSubtitleLocalization
 {
     if (media) {
+        if (! self.letterboxController) {
+            self.letterboxController = [FeedTableViewCell.controllerPool dequeueControllerForView:self.letterboxView];
+        }
+        
         SRGLetterboxPlaybackSettings *settings = [[SRGLetterboxPlaybackSettings alloc] init];
         settings.standalone = ApplicationSettingStandalone();
         settings.quality = ApplicationSettingPreferredQuality();
@@ -43,13 +94,13 @@
         [self.letterboxController playMedia:media atPosition:nil withPreferredSettings:settings];
     }
     else {
-        [self.letterboxController reset];
+        self.letterboxController = nil;
     }
 }
 
 - (BOOL)isMuted
 {
-    return self.letterboxController.muted;
+    return self.letterboxController ? self.letterboxController.muted : YES;
 }
 
 - (void)setMuted:(BOOL)muted
@@ -67,15 +118,6 @@
     self.letterboxView.userInteractionEnabled = NO;
     self.progressView.userInteractionEnabled = NO;
     
-    self.letterboxController = [[SRGLetterboxController alloc] init];
-    self.letterboxController.serviceURL = ApplicationSettingServiceURL();
-    self.letterboxController.updateInterval = ApplicationSettingUpdateInterval();
-    self.letterboxController.globalParameters = ApplicationSettingGlobalParameters();
-    self.letterboxController.backgroundVideoPlaybackEnabled = ApplicationSettingIsBackgroundVideoPlaybackEnabled();
-    self.letterboxController.muted = YES;
-    self.letterboxController.resumesAfterRouteBecomesUnavailable = YES;
-    self.letterboxView.controller = self.letterboxController;
-    
     [self.letterboxView setUserInterfaceHidden:YES animated:NO togglable:NO];
     [self.letterboxView setTimelineAlwaysHidden:YES animated:NO];
     
@@ -88,7 +130,8 @@
     
     self.progressView.hidden = YES;
     
-    self.letterboxController.muted = YES;
+    // Give the controller back to the pool, a controller is borrowed again when a media is set
+    self.letterboxController = nil;
     self.soundIndicatorImageView.image = [UIImage imageNamed:@"sound_off"];
 }
 
@@ -97,11 +140,7 @@
     [super willMoveToWindow:newWindow];
     
     if (newWindow) {
-        @weakify(self)
-        self.periodicTimeObserver = [self.letterboxController addPeriodicTimeObserverForInterval:CMTimeMakeWithSeconds(1., NSEC_PER_SEC) queue:NULL usingBlock:^(CMTime time) {
-            @strongify(self)
-            [self updateProgressWithTime:time];
-        }];
+        [self addPeriodicTimeObserver];
     }
     else {
         [self.letterboxController removePeriodicTimeObserver:self.periodicTimeObserver];
@@ -120,6 +159,19 @@
     // See https://stackoverflow.com/questions/27904177/uiimageview-animation-stops-when-user-touches-screen/29330962
 }
 
+#pragma mark Periodic time observer
+
+- (void)addPeriodicTimeObserver
+{
+    [self.letterboxController removePeriodicTimeObserver:self.periodicTimeObserver];
+    
+    @weakify(self)
+    self.periodicTimeObserver = [self.letterboxController addPeriodicTimeObserverForInterval:CMTimeMakeWithSeconds(1., NSEC_PER_SEC) queue:NULL usingBlock:^(CMTime time) {
+        @strongify(self)
+        [self updateProgressWithTime:time];
+    }];
+}
+
 #pragma UI
 
 - (void)updateProgressWithTime:(CMTime)time
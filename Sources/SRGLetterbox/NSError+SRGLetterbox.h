@@ -15,6 +15,12 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, readonly, nullable) NSError *srg_letterboxNoNetworkError;
 
+/**
+ *  Return the first error related to a transient network issue (no network, connection lost or timed out, host not
+ *  reachable), from the error to underlying errors.
+ */
+@property (nonatomic, readonly, nullable) NSError *srg_letterboxTransientNetworkError;
+
 /**
  *  Return the best raw underlying error, from the error to underlying errors.
  */
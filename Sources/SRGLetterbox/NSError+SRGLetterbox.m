@@ -27,6 +27,28 @@
     return nil;
 }
 
+- (NSError *)srg_letterboxTransientNetworkError
+{
+    static NSSet<NSNumber *> *s_transientErrorCodes;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        s_transientErrorCodes = [NSSet setWithObjects:@(NSURLErrorNotConnectedToInternet), @(NSURLErrorNetworkConnectionLost), @(NSURLErrorTimedOut),
+                                 @(NSURLErrorCannotFindHost), @(NSURLErrorCannotConnectToHost), @(NSURLErrorDNSLookupFailed), nil];
+    });
+    
+    NSError *error = self;
+    while (error) {
+        // CFNetwork error codes are identical to their NSURLErrorDomain counterparts
+        if (([error.domain isEqualToString:NSURLErrorDomain] || [error.domain isEqualToString:(NSString *)kCFErrorDomainCFNetwork])
+                && [s_transientErrorCodes containsObject:@(error.code)]) {
+            return error;
+        }
+        
+        error = error.userInfo[NSUnderlyingErrorKey];
+    }
+    return nil;
+}
+
 - (NSError *)srg_letterboxUnderlyingError
 {
     NSError *error = self;
@@ -16,8 +16,10 @@
 #import "SRGImageButton.h"
 #import "SRGLetterboxController+Private.h"
 #import "UIColor+SRGLetterbox.h"
+#import "UIImage+SRGLetterbox.h"
 #import "UIImageView+SRGLetterbox.h"
 
+@import libextobjc;
 @import SRGAppearance;
 @import YYWebImage;
 
@@ -117,7 +119,19 @@ static NSString *SRGLocalizedUppercaseString(NSString *string)
     [super viewWillAppear:animated];
     
     if (self.movingToParentViewController || self.beingPresented) {
-        self.backgroundImageView.image = [UIImage srg_vectorImageAtPath:SRGLetterboxFilePathForImagePlaceholder() withSize:self.backgroundImageView.frame.size];
+        // Rasterise the placeholder in the background if not readily available
+        CGFloat width = CGRectGetWidth(self.view.bounds);
+        UIImage *placeholderImage = [UIImage srg_letterboxCachedVectorImageAtPath:SRGLetterboxFilePathForImagePlaceholder() withWidth:width tintColor:nil];
+        if (placeholderImage) {
+            self.backgroundImageView.image = placeholderImage;
+        }
+        else {
+            @weakify(self)
+            [UIImage srg_letterboxRequestVectorImageAtPath:SRGLetterboxFilePathForImagePlaceholder() withWidth:width tintColor:nil completion:^(UIImage * _Nullable image) {
+                @strongify(self)
+                self.backgroundImageView.image = image;
+            }];
+        }
         
         self.timer = [NSTimer srgletterbox_timerWithTimeInterval:1. repeats:YES block:^(NSTimer * _Nonnull timer) {
             [self reloadTimeInformation];
@@ -332,7 +346,7 @@ static NSString *SRGLocalizedUppercaseString(NSString *string)
     
     self.thumbnailButton.accessibilityLabel = self.media.title;
     self.thumbnailButton.accessibilityHint = SRGLetterboxAccessibilityLocalizedString(@"Plays the content.", @"Segment or chapter cell hint");
-    [self.thumbnailButton.imageView srg_requestImage:self.media.image withSize:SRGImageSizeMedium controller:self.controller];
+    [self.thumbnailButton.imageView srg_requestImage:self.media.image withSize:SRGImageSizeMedium priority:SRGLetterboxImagePriorityVisible controller:self.controller];
     
     self.upcomingTitleLabel.text = self.upcomingMedia.title;
     self.upcomingTitleLabel.isAccessibilityElement = NO;
@@ -344,7 +358,7 @@ static NSString *SRGLocalizedUppercaseString(NSString *string)
     self.upcomingSummaryLabel.isAccessibilityElement = NO;
     
     self.upcomingThumbnailButton.accessibilityHint = SRGLetterboxAccessibilityLocalizedString(@"Plays the content.", @"Segment or chapter cell hint");
-    [self.upcomingThumbnailButton.imageView srg_requestImage:self.upcomingMedia.image withSize:SRGImageSizeMedium controller:self.controller];
+    [self.upcomingThumbnailButton.imageView srg_requestImage:self.upcomingMedia.image withSize:SRGImageSizeMedium priority:SRGLetterboxImagePriorityUpcoming controller:self.controller];
 }
 
 - (void)reloadTimeInformation
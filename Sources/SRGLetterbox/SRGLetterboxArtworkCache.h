@@ -0,0 +1,67 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGLetterboxImageLoader.h"
+
+@import UIKit;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Small least recently used cache of control center artwork images, keyed by media URN. Images are retrieved once
+ *  and rendered on demand at the sizes requested by the system (lock screen, control center, CarPlay), each rendered
+ *  size being kept alongside the original image.
+ *
+ *  @discussion Lookups and rendering are thread-safe, as artwork request handlers might be called on any thread.
+ *              Other methods must be called from the main thread.
+ */
+API_UNAVAILABLE(tvos)
+@interface SRGLetterboxArtworkCache : NSObject
+
+/**
+ *  Create a cache holding artwork for at most `capacity` medias.
+ */
+- (instancetype)initWithCapacity:(NSUInteger)capacity;
+
+/**
+ *  The image available for the specified URN, provided it was retrieved from the specified URL. Returns `nil` if no
+ *  image is available (yet).
+ */
+- (nullable UIImage *)imageForURN:(NSString *)URN URL:(NSURL *)URL;
+
+/**
+ *  Same as `-imageForURN:URL:`, but with the image rendered to fit the specified size (never larger than the
+ *  original image).
+ */
+- (nullable UIImage *)imageForURN:(NSString *)URN URL:(NSURL *)URL withSize:(CGSize)size;
+
+/**
+ *  Retrieve the image for the specified URN and URL with a given priority, calling the completion block on the main thread
+ *  when done (also if the image was already available). Concurrent requests for the same URN and URL are coalesced. A `nil`
+ *  image is returned on failure.
+ */
+- (void)requestImageForURN:(NSString *)URN URL:(NSURL *)URL priority:(SRGLetterboxImagePriority)priority withCompletionBlock:(nullable void (^)(UIImage * _Nullable image, NSError * _Nullable error))completionBlock;
+
+/**
+ *  Remove images which could not be retrieved, so that they can be requested again. Returns `YES` iff some images were
+ *  removed.
+ */
+- (BOOL)removeFailedImages;
+
+/**
+ *  Remove all images.
+ */
+- (void)removeAllImages;
+
+@end
+
+@interface SRGLetterboxArtworkCache (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,251 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import <TargetConditionals.h>
+
+#if TARGET_OS_IOS
+
+#import "SRGLetterboxArtworkCache.h"
+
+#import "SRGLetterboxLogger.h"
+
+@import libextobjc;
+
+static NSString *SRGLetterboxArtworkCacheSizeKey(CGSize size)
+{
+    return [NSString stringWithFormat:@"%@x%@", @(size.width), @(size.height)];
+}
+
+@interface SRGLetterboxArtworkCacheEntry : NSObject
+
+@property (nonatomic) NSURL *URL;
+@property (nonatomic) UIImage *image;
+@property (nonatomic) NSError *error;
+@property (nonatomic) NSMutableDictionary<NSString *, UIImage *> *renderedImages;
+
+@property (nonatomic) YYWebImageOperation *imageOperation;
+@property (nonatomic) NSMutableArray<void (^)(UIImage * _Nullable, NSError * _Nullable)> *completionBlocks;
+
+@end
+
+@interface SRGLetterboxArtworkCache ()
+
+@property (nonatomic) NSUInteger capacity;
+
+// Entries by URN, most recently used URNs last
+@property (nonatomic) NSMutableDictionary<NSString *, SRGLetterboxArtworkCacheEntry *> *entries;
+@property (nonatomic) NSMutableArray<NSString *> *URNs;
+
+@end
+
+@implementation SRGLetterboxArtworkCache
+
+#pragma mark Object lifecycle
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity
+{
+    if (self = [super init]) {
+        self.capacity = MAX(capacity, 1);
+        self.entries = [NSMutableDictionary dictionary];
+        self.URNs = [NSMutableArray array];
+        
+        [NSNotificationCenter.defaultCenter addObserver:self
+                                               selector:@selector(applicationDidReceiveMemoryWarning:)
+                                                   name:UIApplicationDidReceiveMemoryWarningNotification
+                                                 object:nil];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    [self removeAllImages];
+}
+
+#pragma mark Lookup
+
+- (UIImage *)imageForURN:(NSString *)URN URL:(NSURL *)URL
+{
+    @synchronized(self) {
+        SRGLetterboxArtworkCacheEntry *entry = self.entries[URN];
+        return [entry.URL isEqual:URL] ? entry.image : nil;
+    }
+}
+
+- (UIImage *)imageForURN:(NSString *)URN URL:(NSURL *)URL withSize:(CGSize)size
+{
+    SRGLetterboxArtworkCacheEntry *entry = nil;
+    UIImage *image = nil;
+    
+    @synchronized(self) {
+        entry = self.entries[URN];
+        if (! [entry.URL isEqual:URL] || ! entry.image) {
+            return nil;
+        }
+        
+        image = entry.image;
+        
+        // Never upscale. The original image is the best we have in this case.
+        if (size.width <= 0.f || size.height <= 0.f || (size.width >= image.size.width && size.height >= image.size.height)) {
+            return image;
+        }
+        
+        UIImage *renderedImage = entry.renderedImages[SRGLetterboxArtworkCacheSizeKey(size)];
+        if (renderedImage) {
+            return renderedImage;
+        }
+    }
+    
+    // Render outside the lock, so that lookups for other sizes are not blocked
+    CGFloat ratio = fmin(size.width / image.size.width, size.height / image.size.height);
+    CGSize renderedSize = CGSizeMake(round(image.size.width * ratio), round(image.size.height * ratio));
+    UIGraphicsImageRenderer *renderer = [[UIGraphicsImageRenderer alloc] initWithSize:renderedSize];
+    UIImage *renderedImage = [renderer imageWithActions:^(UIGraphicsImageRendererContext * _Nonnull rendererContext) {
+        [image drawInRect:CGRectMake(0.f, 0.f, renderedSize.width, renderedSize.height)];
+    }];
+    
+    @synchronized(self) {
+        entry.renderedImages[SRGLetterboxArtworkCacheSizeKey(size)] = renderedImage;
+    }
+    return renderedImage;
+}
+
+#pragma mark Requests
+
+- (void)requestImageForURN:(NSString *)URN URL:(NSURL *)URL priority:(SRGLetterboxImagePriority)priority withCompletionBlock:(void (^)(UIImage * _Nullable, NSError * _Nullable))completionBlock
+{
+    SRGLetterboxArtworkCacheEntry *entry = nil;
+    
+    @synchronized(self) {
+        entry = self.entries[URN];
+        if (! [entry.URL isEqual:URL]) {
+            [entry.imageOperation cancel];
+            
+            entry = [[SRGLetterboxArtworkCacheEntry alloc] init];
+            entry.URL = URL;
+            entry.renderedImages = [NSMutableDictionary dictionary];
+            entry.completionBlocks = [NSMutableArray array];
+            self.entries[URN] = entry;
+        }
+        
+        [self.URNs removeObject:URN];
+        [self.URNs addObject:URN];
+        
+        while (self.URNs.count > self.capacity) {
+            NSString *evictedURN = self.URNs.firstObject;
+            [self.entries[evictedURN].imageOperation cancel];
+            [self.entries removeObjectForKey:evictedURN];
+            [self.URNs removeObjectAtIndex:0];
+        }
+    }
+    
+    if (entry.image || entry.error) {
+        completionBlock ? completionBlock(entry.image, entry.error) : nil;
+        return;
+    }
+    
+    if (completionBlock) {
+        [entry.completionBlocks addObject:completionBlock];
+    }
+    
+    if (entry.imageOperation) {
+        // Promote prefetched images when they are needed
+        if (priority == SRGLetterboxImagePriorityPoster) {
+            entry.imageOperation.queuePriority = NSOperationQueuePriorityVeryHigh;
+        }
+        return;
+    }
+    
+    // Overridden images might be provided as file URLs
+    if (URL.fileURL) {
+        [self finishEntry:entry withImage:[UIImage imageWithContentsOfFile:URL.path] error:nil];
+        return;
+    }
+    
+    SRGLetterboxLogDebug(@"service", @"Artwork image request for %@ triggered", URN);
+    
+    @weakify(self) @weakify(entry)
+    entry.imageOperation = [SRGLetterboxImageLoader requestImageWithURL:URL priority:priority completion:^(UIImage * _Nullable image, NSURL * _Nonnull url, YYWebImageFromType from, YYWebImageStage stage, NSError * _Nullable error) {
+        dispatch_async(dispatch_get_main_queue(), ^{
+            @strongify(self) @strongify(entry)
+            [self finishEntry:entry withImage:image error:error];
+        });
+    }];
+}
+
+- (void)finishEntry:(SRGLetterboxArtworkCacheEntry *)entry withImage:(UIImage *)image error:(NSError *)error
+{
+    NSArray<void (^)(UIImage * _Nullable, NSError * _Nullable)> *completionBlocks = nil;
+    
+    @synchronized(self) {
+        entry.image = image;
+        entry.error = image ? nil : (error ?: [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorCannotDecodeContentData userInfo:nil]);
+        entry.imageOperation = nil;
+        
+        completionBlocks = entry.completionBlocks.copy;
+        [entry.completionBlocks removeAllObjects];
+    }
+    
+    for (void (^completionBlock)(UIImage * _Nullable, NSError * _Nullable) in completionBlocks) {
+        completionBlock(entry.image, entry.error);
+    }
+}
+
+#pragma mark Removal
+
+- (BOOL)removeFailedImages
+{
+    @synchronized(self) {
+        NSArray<NSString *> *failedURNs = [self.entries keysOfEntriesPassingTest:^BOOL(NSString * _Nonnull URN, SRGLetterboxArtworkCacheEntry * _Nonnull entry, BOOL * _Nonnull stop) {
+            return entry.error != nil;
+        }].allObjects;
+        [self.entries removeObjectsForKeys:failedURNs];
+        [self.URNs removeObjectsInArray:failedURNs];
+        return failedURNs.count != 0;
+    }
+}
+
+- (void)removeAllImages
+{
+    @synchronized(self) {
+        [self.entries enumerateKeysAndObjectsUsingBlock:^(NSString * _Nonnull URN, SRGLetterboxArtworkCacheEntry * _Nonnull entry, BOOL * _Nonnull stop) {
+            [entry.imageOperation cancel];
+        }];
+        [self.entries removeAllObjects];
+        [self.URNs removeAllObjects];
+    }
+}
+
+#pragma mark Notifications
+
+- (void)applicationDidReceiveMemoryWarning:(NSNotification *)notification
+{
+    // Rendered images can be recreated from the original ones at any time
+    @synchronized(self) {
+        [self.entries enumerateKeysAndObjectsUsingBlock:^(NSString * _Nonnull URN, SRGLetterboxArtworkCacheEntry * _Nonnull entry, BOOL * _Nonnull stop) {
+            [entry.renderedImages removeAllObjects];
+        }];
+    }
+}
+
+#pragma mark Description
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p; capacity = %@; URNs = %@>",
+            self.class,
+            self,
+            @(self.capacity),
+            self.URNs];
+}
+
+@end
+
+@implementation SRGLetterboxArtworkCacheEntry
+
+@end
+
+#endif
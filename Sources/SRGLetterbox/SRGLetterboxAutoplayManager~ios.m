@@ -0,0 +1,300 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import <TargetConditionals.h>
+
+#if TARGET_OS_IOS
+
+#import "SRGLetterboxAutoplayManager.h"
+
+#import "SRGLetterboxService.h"
+
+@import libextobjc;
+@import MAKVONotificationCenter;
+
+/**
+ *  Information about a registered view.
+ */
+@interface SRGLetterboxAutoplayEntry : NSObject
+
+@property (nonatomic, weak) SRGLetterboxView *letterboxView;
+@property (nonatomic) SRGMedia *media;
+@property (nonatomic) SRGLetterboxPlaybackSettings *preferredSettings;
+
+// Position to resume at after the player has been released
+@property (nonatomic) SRGPosition *position;
+
+@end
+
+@interface SRGLetterboxAutoplayManager ()
+
+@property (nonatomic, weak) UIScrollView *scrollView;
+@property (nonatomic) NSUInteger maximumPlayingCount;
+
+@property (nonatomic) NSMapTable<SRGLetterboxView *, SRGLetterboxAutoplayEntry *> *entries;
+
+@end
+
+@implementation SRGLetterboxAutoplayManager
+
+#pragma mark Object lifecycle
+
+- (instancetype)initWithScrollView:(UIScrollView *)scrollView maximumPlayingCount:(NSUInteger)maximumPlayingCount
+{
+    if (self = [super init]) {
+        self.scrollView = scrollView;
+        self.maximumPlayingCount = maximumPlayingCount;
+        self.visibilityThreshold = 0.5f;
+        self.preparationDistance = 200.f;
+        self.releasesPlayersOutsideViewport = YES;
+        self.entries = [NSMapTable weakToStrongObjectsMapTable];
+        
+        @weakify(self)
+        [scrollView addObserver:self keyPath:@keypath(scrollView.contentOffset) options:0 block:^(MAKVONotification *notification) {
+            @strongify(self)
+            [self updateVisibility];
+        }];
+        [scrollView addObserver:self keyPath:@keypath(scrollView.bounds) options:0 block:^(MAKVONotification *notification) {
+            @strongify(self)
+            [self updateVisibility];
+        }];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    UIScrollView *scrollView = self.scrollView;
+    [scrollView removeObserver:self keyPath:@keypath(scrollView.contentOffset)];
+    [scrollView removeObserver:self keyPath:@keypath(scrollView.bounds)];
+}
+
+#pragma mark Getters and setters
+
+- (void)setVisibilityThreshold:(CGFloat)visibilityThreshold
+{
+    _visibilityThreshold = fmin(fmax(visibilityThreshold, 0.f), 1.f);
+}
+
+- (void)setPreparationDistance:(CGFloat)preparationDistance
+{
+    _preparationDistance = fmax(preparationDistance, 0.f);
+}
+
+#pragma mark Registration
+
+- (void)registerLetterboxView:(SRGLetterboxView *)letterboxView withMedia:(SRGMedia *)media preferredSettings:(SRGLetterboxPlaybackSettings *)preferredSettings
+{
+    SRGLetterboxAutoplayEntry *entry = [self.entries objectForKey:letterboxView];
+    if (! entry || ! [entry.media isEqual:media]) {
+        entry = [[SRGLetterboxAutoplayEntry alloc] init];
+        entry.letterboxView = letterboxView;
+        entry.media = media;
+        [self.entries setObject:entry forKey:letterboxView];
+    }
+    entry.preferredSettings = preferredSettings;
+    
+    [self updateVisibility];
+}
+
+- (void)unregisterLetterboxView:(SRGLetterboxView *)letterboxView
+{
+    if (! [self.entries objectForKey:letterboxView]) {
+        return;
+    }
+    
+    [self.entries removeObjectForKey:letterboxView];
+    
+    SRGLetterboxController *controller = letterboxView.controller;
+    if (! [self isPictureInPictureController:controller]) {
+        [controller reset];
+    }
+    
+    [self updateVisibility];
+}
+
+#pragma mark Visibility
+
+- (void)updateVisibility
+{
+    UIScrollView *scrollView = self.scrollView;
+    if (! scrollView) {
+        return;
+    }
+    
+    CGRect viewport = scrollView.bounds;
+    CGRect preparationViewport = CGRectInset(viewport, -self.preparationDistance, -self.preparationDistance);
+    CGPoint viewportCenter = CGPointMake(CGRectGetMidX(viewport), CGRectGetMidY(viewport));
+    
+    NSMutableArray<SRGLetterboxAutoplayEntry *> *visibleEntries = [NSMutableArray array];
+    NSMutableArray<SRGLetterboxAutoplayEntry *> *upcomingEntries = [NSMutableArray array];
+    NSMutableArray<SRGLetterboxAutoplayEntry *> *outsideEntries = [NSMutableArray array];
+    
+    NSMapTable<SRGLetterboxAutoplayEntry *, NSNumber *> *visibleFractions = [NSMapTable strongToStrongObjectsMapTable];
+    NSMapTable<SRGLetterboxAutoplayEntry *, NSNumber *> *distances = [NSMapTable strongToStrongObjectsMapTable];
+    
+    for (SRGLetterboxAutoplayEntry *entry in self.entries.objectEnumerator) {
+        SRGLetterboxView *letterboxView = entry.letterboxView;
+        if (! letterboxView.controller) {
+            continue;
+        }
+        
+        if (! letterboxView.window || ! [letterboxView isDescendantOfView:scrollView]) {
+            [outsideEntries addObject:entry];
+            continue;
+        }
+        
+        CGRect frame = [letterboxView convertRect:letterboxView.bounds toView:scrollView];
+        CGFloat area = CGRectGetWidth(frame) * CGRectGetHeight(frame);
+        CGRect visibleFrame = CGRectIntersection(frame, viewport);
+        CGFloat visibleFraction = (area > 0.f && ! CGRectIsNull(visibleFrame)) ? CGRectGetWidth(visibleFrame) * CGRectGetHeight(visibleFrame) / area : 0.f;
+        CGFloat distance = hypot(CGRectGetMidX(frame) - viewportCenter.x, CGRectGetMidY(frame) - viewportCenter.y);
+        
+        [visibleFractions setObject:@(visibleFraction) forKey:entry];
+        [distances setObject:@(distance) forKey:entry];
+        
+        if (visibleFraction > 0.f) {
+            [visibleEntries addObject:entry];
+        }
+        else if (CGRectIntersectsRect(frame, preparationViewport)) {
+            [upcomingEntries addObject:entry];
+        }
+        else {
+            [outsideEntries addObject:entry];
+        }
+    }
+    
+    // Most visible views first, then closest to the viewport center
+    [visibleEntries sortUsingComparator:^NSComparisonResult(SRGLetterboxAutoplayEntry * _Nonnull entry1, SRGLetterboxAutoplayEntry * _Nonnull entry2) {
+        NSComparisonResult result = [[visibleFractions objectForKey:entry2] compare:[visibleFractions objectForKey:entry1]];
+        return (result != NSOrderedSame) ? result : [[distances objectForKey:entry1] compare:[distances objectForKey:entry2]];
+    }];
+    [upcomingEntries sortUsingComparator:^NSComparisonResult(SRGLetterboxAutoplayEntry * _Nonnull entry1, SRGLetterboxAutoplayEntry * _Nonnull entry2) {
+        return [[distances objectForKey:entry1] compare:[distances objectForKey:entry2]];
+    }];
+    
+    // Release first, so that resources are available for views which need them
+    for (SRGLetterboxAutoplayEntry *entry in outsideEntries) {
+        [self releaseEntry:entry];
+    }
+    
+    NSUInteger playingCount = 0;
+    for (SRGLetterboxAutoplayEntry *entry in visibleEntries) {
+        if (playingCount < self.maximumPlayingCount && [[visibleFractions objectForKey:entry] floatValue] >= self.visibilityThreshold) {
+            [self playEntry:entry];
+            ++playingCount;
+        }
+        else {
+            [self pauseEntry:entry];
+        }
+    }
+    
+    // Only prepare the view which will scroll in first. Other ones are released.
+    [upcomingEntries enumerateObjectsUsingBlock:^(SRGLetterboxAutoplayEntry * _Nonnull entry, NSUInteger idx, BOOL * _Nonnull stop) {
+        if (idx == 0) {
+            [self prepareEntry:entry];
+        }
+        else {
+            [self releaseEntry:entry];
+        }
+    }];
+}
+
+#pragma mark Playback
+
+- (BOOL)isPictureInPictureController:(SRGLetterboxController *)controller
+{
+    return controller.pictureInPictureActive && SRGLetterboxService.sharedService.controller == controller;
+}
+
+// Controllers remain idle while retrieving metadata, as well as for good when the media is blocked or could not be played.
+// Loading the same media again in such cases would cancel and restart metadata retrieval at each visibility update.
+- (BOOL)isEntryLoaded:(SRGLetterboxAutoplayEntry *)entry
+{
+    SRGLetterboxController *controller = entry.letterboxView.controller;
+    if (! [controller.URN isEqualToString:entry.media.URN]) {
+        return NO;
+    }
+    
+    return controller.playbackState != SRGMediaPlayerPlaybackStateIdle || controller.loading
+        || controller.dataAvailability != SRGLetterboxDataAvailabilityNone || controller.error;
+}
+
+- (void)playEntry:(SRGLetterboxAutoplayEntry *)entry
+{
+    SRGLetterboxController *controller = entry.letterboxView.controller;
+    if ([self isEntryLoaded:entry]) {
+        if (controller.playbackState == SRGMediaPlayerPlaybackStatePaused) {
+            [controller play];
+        }
+    }
+    else {
+        [controller playMedia:entry.media atPosition:entry.position withPreferredSettings:entry.preferredSettings];
+    }
+}
+
+- (void)prepareEntry:(SRGLetterboxAutoplayEntry *)entry
+{
+    SRGLetterboxController *controller = entry.letterboxView.controller;
+    if ([self isEntryLoaded:entry]) {
+        [controller pause];
+    }
+    else {
+        [controller prepareToPlayMedia:entry.media atPosition:entry.position withPreferredSettings:entry.preferredSettings completionHandler:nil];
+    }
+}
+
+- (void)pauseEntry:(SRGLetterboxAutoplayEntry *)entry
+{
+    SRGLetterboxController *controller = entry.letterboxView.controller;
+    if ([self isPictureInPictureController:controller]) {
+        return;
+    }
+    
+    if ([self isEntryLoaded:entry]) {
+        [controller pause];
+    }
+}
+
+- (void)releaseEntry:(SRGLetterboxAutoplayEntry *)entry
+{
+    if (! self.releasesPlayersOutsideViewport) {
+        [self pauseEntry:entry];
+        return;
+    }
+    
+    SRGLetterboxController *controller = entry.letterboxView.controller;
+    if ([self isPictureInPictureController:controller] || ! [self isEntryLoaded:entry]) {
+        return;
+    }
+    
+    // Resume on-demand medias where they were left (controllers still loading or which failed have no meaningful position)
+    if (controller.playbackState != SRGMediaPlayerPlaybackStateIdle && controller.media.contentType != SRGContentTypeLivestream
+            && CMTIME_IS_NUMERIC(controller.currentTime)) {
+        entry.position = [SRGPosition positionAtTime:controller.currentTime];
+    }
+    [controller reset];
+}
+
+#pragma mark Description
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p; scrollView = %@; maximumPlayingCount = %@; entries = %@>",
+            self.class,
+            self,
+            self.scrollView,
+            @(self.maximumPlayingCount),
+            @(self.entries.count)];
+}
+
+@end
+
+@implementation SRGLetterboxAutoplayEntry
+
+@end
+
+#endif
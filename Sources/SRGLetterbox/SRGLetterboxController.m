@@ -12,9 +12,14 @@
 #import "SRGLetterbox.h"
 #import "SRGLetterboxService+Private.h"
 #import "SRGLetterboxError.h"
+#import "SRGLetterboxHedgedMediaCompositionRequest.h"
+#import "SRGLetterboxImageLoader.h"
 #import "SRGLetterboxLogger.h"
+#import "SRGLetterboxMediaCompositionPreloader.h"
+#import "SRGLetterboxMediaCompositionStore.h"
 #import "SRGMediaComposition+SRGLetterbox.h"
 #import "UIDevice+SRGLetterbox.h"
+#import "UIImage+SRGLetterbox.h"
 
 @import FXReachability;
 @import libextobjc;
@@ -58,6 +63,16 @@ NSString * const SRGLetterboxErrorKey = @"SRGLetterboxError";
 
 static NSString * const SRGLetterboxDiagnosticServiceName = @"SRGPlaybackMetrics";
 
+// Maximum age of a preloaded media composition for it to be used instead of a fresh one
+static const NSTimeInterval SRGLetterboxPreloadedMediaCompositionMaximumAge = 120.;
+
+// Minimum interval between two playback position saves
+static const NSTimeInterval SRGLetterboxPositionSaveInterval = 5.;
+
+// Maximum age of the media composition for a retry to reuse it. Older media compositions are retrieved again, as the
+// resource URLs they contain might have expired meanwhile.
+static const NSTimeInterval SRGLetterboxRetriedMediaCompositionMaximumAge = 10. * 60.;
+
 static NSError *SRGBlockingReasonErrorForMedia(SRGMedia *media, NSDate *date)
 {
     SRGBlockingReason blockingReason = [media blockingReasonAtDate:date];
@@ -87,6 +102,133 @@ static BOOL SRGLetterboxControllerIsLoading(SRGLetterboxDataAvailability dataAva
     return isPlayerLoading || dataAvailability == SRGLetterboxDataAvailabilityLoading;
 }
 
+static NSUInteger s_maximumActivePlayerCount = 0;
+
+// Controllers with an active player or parked, subject to the player budget
+static NSHashTable<SRGLetterboxController *> *SRGLetterboxControllerBudgetedControllers(void)
+{
+    static dispatch_once_t s_onceToken;
+    static NSHashTable<SRGLetterboxController *> *s_controllers;
+    dispatch_once(&s_onceToken, ^{
+        s_controllers = [NSHashTable weakObjectsHashTable];
+    });
+    return s_controllers;
+}
+
+// Data providers are shared between controllers with the same configuration, for the whole application lifetime, so that
+// their network sessions (and thus open connections to the service) are reused between consecutive playbacks.
+static SRGDataProvider *SRGLetterboxSharedDataProvider(NSURL *serviceURL, NSDictionary<NSString *, NSString *> *globalHeaders, NSDictionary<NSString *, NSString *> *globalParameters)
+{
+    static dispatch_once_t s_onceToken;
+    static NSMutableDictionary<NSArray *, SRGDataProvider *> *s_dataProviders;
+    dispatch_once(&s_onceToken, ^{
+        s_dataProviders = [NSMutableDictionary dictionary];
+    });
+    
+    NSArray *key = @[ serviceURL, globalHeaders.copy ?: @{}, globalParameters.copy ?: @{} ];
+    
+    @synchronized(s_dataProviders) {
+        SRGDataProvider *dataProvider = s_dataProviders[key];
+        if (! dataProvider) {
+            dataProvider = [[SRGDataProvider alloc] initWithServiceURL:serviceURL];
+            dataProvider.globalHeaders = globalHeaders;
+            dataProvider.globalParameters = globalParameters;
+            s_dataProviders[key] = dataProvider;
+        }
+        return dataProvider;
+    }
+}
+
+// Minimum interval between two connection prewarms to the same origin. Idle connections are usually kept open longer.
+static const NSTimeInterval SRGLetterboxConnectionPrewarmInterval = 30.;
+
+// Return the origin (scheme, host and port) of the specified URL, `nil` if none
+static NSURL *SRGLetterboxOriginURL(NSURL *URL)
+{
+    if (! URL.host || URL.fileURL) {
+        return nil;
+    }
+    
+    NSURLComponents *URLComponents = [[NSURLComponents alloc] init];
+    URLComponents.scheme = URL.scheme;
+    URLComponents.host = URL.host;
+    URLComponents.port = URL.port;
+    URLComponents.path = @"/";
+    return URLComponents.URL;
+}
+
+// File in which the origin of the last stream played is saved, so that connections can be prewarmed at application startup
+static NSURL *SRGLetterboxStreamOriginFileURL(void)
+{
+    NSURL *cachesDirectoryURL = [NSFileManager.defaultManager URLsForDirectory:NSCachesDirectory inDomains:NSUserDomainMask].firstObject;
+    return [cachesDirectoryURL URLByAppendingPathComponent:@"ch.srgssr.letterbox.streamOrigin"];
+}
+
+// Saved stream origin, read once from disk. Must be accessed from the main thread.
+static NSString *s_streamOriginURLString;
+
+static NSString *SRGLetterboxSavedStreamOriginURLString(void)
+{
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        s_streamOriginURLString = [NSString stringWithContentsOfURL:SRGLetterboxStreamOriginFileURL() encoding:NSUTF8StringEncoding error:NULL];
+    });
+    return s_streamOriginURLString;
+}
+
+static void SRGLetterboxSaveStreamOriginURLString(NSString *streamOriginURLString)
+{
+    if ([streamOriginURLString isEqualToString:SRGLetterboxSavedStreamOriginURLString()]) {
+        return;
+    }
+    
+    static dispatch_once_t s_onceToken;
+    static dispatch_queue_t s_queue;
+    dispatch_once(&s_onceToken, ^{
+        s_queue = dispatch_queue_create("ch.srgssr.letterbox.streamOrigin", DISPATCH_QUEUE_SERIAL);
+        dispatch_set_target_queue(s_queue, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0));
+    });
+    
+    // Written in order, in the background
+    s_streamOriginURLString = streamOriginURLString.copy;
+    dispatch_async(s_queue, ^{
+        [streamOriginURLString writeToURL:SRGLetterboxStreamOriginFileURL() atomically:YES encoding:NSUTF8StringEncoding error:NULL];
+    });
+}
+
+// Resolve the host and open a connection (including the TLS handshake) to the origin of the specified URL. No content
+// is retrieved.
+static void SRGLetterboxPrewarmConnectionToURL(NSURL *URL)
+{
+    NSURL *originURL = SRGLetterboxOriginURL(URL);
+    if (! originURL) {
+        return;
+    }
+    
+    static dispatch_once_t s_onceToken;
+    static NSMutableDictionary<NSURL *, NSDate *> *s_prewarmDates;
+    dispatch_once(&s_onceToken, ^{
+        s_prewarmDates = [NSMutableDictionary dictionary];
+    });
+    
+    @synchronized(s_prewarmDates) {
+        NSDate *prewarmDate = s_prewarmDates[originURL];
+        if (prewarmDate && [NSDate.date timeIntervalSinceDate:prewarmDate] < SRGLetterboxConnectionPrewarmInterval) {
+            return;
+        }
+        s_prewarmDates[originURL] = NSDate.date;
+    }
+    
+    SRGLetterboxLogDebug(@"controller", @"Prewarming connection to %@", originURL);
+    
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:originURL cachePolicy:NSURLRequestReloadIgnoringLocalCacheData timeoutInterval:10.];
+    request.HTTPMethod = @"HEAD";
+    
+    NSURLSessionTask *prewarmTask = [NSURLSession.sharedSession dataTaskWithRequest:request];
+    prewarmTask.priority = NSURLSessionTaskPriorityLow;
+    [prewarmTask resume];
+}
+
 static NSString *SRGDeviceInformation(void)
 {
     return [NSString stringWithFormat:@"%@ (%@)", UIDevice.currentDevice.srg_letterbox_hardware, UIDevice.currentDevice.systemVersion];
@@ -147,6 +289,7 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
 @property (nonatomic) SRGMedia *media;
 @property (nonatomic) SRGMediaComposition *mediaComposition;
 @property (nonatomic) UIImage *spriteSheetImage API_UNAVAILABLE(tvos);
+@property (nonatomic) NSCache<NSURL *, UIImage *> *spriteSheetImageCache API_UNAVAILABLE(tvos);
 @property (nonatomic) SRGChannel *channel;
 @property (nonatomic) SRGSubdivision *subdivision;
 @property (nonatomic) SRGPosition *startPosition;
@@ -157,6 +300,7 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
 @property (nonatomic, copy) NSString *socialCountViewURN;
 
 @property (nonatomic) SRGLetterboxDataAvailability dataAvailability;
+@property (nonatomic, getter=isMetadataStale) BOOL metadataStale;
 @property (nonatomic, getter=isLoading) BOOL loading;
 @property (nonatomic) SRGMediaPlayerPlaybackState playbackState;
 
@@ -164,6 +308,7 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
 @property (nonatomic) float effectivePlaybackRate;
 
 @property (nonatomic) SRGDataProvider *dataProvider;
+@property (nonatomic) double mediaCompositionHedgingPercentile;
 @property (nonatomic) SRGRequestQueue *requestQueue;
 
 // Use timers (not time observers) so that updates are performed also when the controller is idle
@@ -172,12 +317,18 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
 // Timers for single metadata updates at start and end times
 @property (nonatomic) NSTimer *startDateTimer;
 @property (nonatomic) NSTimer *endDateTimer;
+@property (nonatomic) NSTimer *startDatePrefetchTimer;
+@property (nonatomic) NSTimer *startDatePreparationTimer;
 @property (nonatomic) NSTimer *livestreamEndDateTimer;
 @property (nonatomic) NSTimer *socialCountViewTimer;
 
 // Timer for continuous playback
 @property (nonatomic) NSTimer *continuousPlaybackTransitionTimer;
 
+// Timer for reconnection after a network loss
+@property (nonatomic) NSTimer *reconnectionTimer;
+@property (nonatomic) NSUInteger reconnectionCount;
+
 @property (nonatomic, copy) SRGLetterboxURLOverridingBlock contentURLOverridingBlock;
 
 @property (nonatomic, weak) id<SRGLetterboxControllerPlaylistDataSource> playlistDataSource;
@@ -188,10 +339,27 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
 @property (nonatomic) NSDate *continuousPlaybackTransitionEndDate;
 @property (nonatomic) SRGMedia *continuousPlaybackUpcomingMedia;
 
+@property (nonatomic) NSTimeInterval upcomingMediaPreloadInterval;
+
 @property (nonatomic) NSTimeInterval updateInterval;
 
+@property (nonatomic) NSTimeInterval scheduledUpdateLead;
+@property (nonatomic) NSTimeInterval scheduledUpdateWindow;
+
+// Random position (between 0 and 1) of the controller within the scheduled update window, drawn once so that repeated
+// metadata updates do not move it
+@property (nonatomic) double scheduledUpdateWindowFraction;
+
+// Set when the player has been prepared ahead of the media start date
+@property (nonatomic) NSTimeInterval startDatePreparationInterval;
+@property (nonatomic, getter=isPreparedForStartDate) BOOL preparedForStartDate;
+
 @property (nonatomic) NSDate *lastUpdateDate;
 
+// Date at which the media composition was last retrieved, and last on-demand playback time, for lightweight retries
+@property (nonatomic) NSDate *mediaCompositionDate;
+@property (nonatomic) CMTime lastPlaybackTime;
+
 @property (nonatomic, getter=isTracked) BOOL tracked;
 
 @property (nonatomic) BOOL allowsExternalPlayback;
@@ -201,6 +369,33 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
 
 @property (nonatomic) SRGDiagnosticReport *report;
 
+@property (nonatomic) SRGLetterboxControllerPriority priority;
+@property (nonatomic, getter=isParked) BOOL parked;
+@property (nonatomic) BOOL resumesAfterUnparking;
+@property (nonatomic) SRGPosition *parkedPosition;
+@property (nonatomic) NSDate *lastActivationDate;
+
+@property (nonatomic) NSTimeInterval reconnectionDelay;
+@property (nonatomic) NSTimeInterval maximumReconnectionDelay;
+
+@property (nonatomic) SRGLetterboxPositionStore *positionStore;
+@property (nonatomic) NSDate *lastPositionSaveDate;
+
+// Media compositions retrieved ahead of time (upcoming media, adjacent channels), so that switching to them requires no request
+@property (nonatomic) SRGLetterboxMediaCompositionPreloader *mediaCompositionPreloader;
+
+@property (nonatomic, copy) NSArray<NSString *> *zappingURNs;
+
+@property (nonatomic) NSURL *preloadedImageURL;
+@property (nonatomic) YYWebImageOperation *preloadImageOperation;
+
+@property (nonatomic) id preloadTimeObserver;
+
+// Data retrieved in the background for chapters adjacent to the one being played
+@property (nonatomic, copy) NSString *prefetchedChapterURN;
+@property (nonatomic) SRGRequestQueue *chapterPrefetchRequestQueue;
+@property (nonatomic) NSArray<NSURLSessionTask *> *playlistPrefetchTasks;
+
 @end
 
 @implementation SRGLetterboxController
@@ -239,6 +434,10 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
         // Also register the associated periodic time observers
         self.updateInterval = SRGLetterboxDefaultUpdateInterval;
         
+        self.scheduledUpdateLead = SRGLetterboxDefaultScheduledUpdateLead;
+        self.scheduledUpdateWindow = SRGLetterboxDefaultScheduledUpdateWindow;
+        self.scheduledUpdateWindowFraction = arc4random_uniform(1001) / 1000.;
+        
         self.playbackState = SRGMediaPlayerPlaybackStateIdle;
         
         _playbackRate = self.mediaPlayerController.playbackRate;
@@ -261,6 +460,31 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
         self.resumesAfterRetry = YES;
         self.resumesAfterRouteBecomesUnavailable = NO;
         
+        _priority = SRGLetterboxControllerPriorityDefault;
+        
+        self.reconnectionDelay = SRGLetterboxDefaultReconnectionDelay;
+        self.maximumReconnectionDelay = SRGLetterboxDefaultMaximumReconnectionDelay;
+        
+        self.upcomingMediaPreloadInterval = SRGLetterboxDefaultUpcomingMediaPreloadInterval;
+        self.mediaCompositionPreloader = [[SRGLetterboxMediaCompositionPreloader alloc] initWithMaximumAge:SRGLetterboxPreloadedMediaCompositionMaximumAge];
+        
+#if TARGET_OS_IOS
+        self.spriteSheetImageCache = [[NSCache alloc] init];
+        self.spriteSheetImageCache.countLimit = 3;
+#endif
+        
+        self.preloadTimeObserver = [self.mediaPlayerController addPeriodicTimeObserverForInterval:CMTimeMakeWithSeconds(1., NSEC_PER_SEC) queue:NULL usingBlock:^(CMTime time) {
+            @strongify(self)
+            if (self.mediaPlayerController.streamType == SRGMediaPlayerStreamTypeOnDemand) {
+                self.lastPlaybackTime = time;
+                
+                if (! self.lastPositionSaveDate || [NSDate.date timeIntervalSinceDate:self.lastPositionSaveDate] >= SRGLetterboxPositionSaveInterval) {
+                    [self savePosition];
+                }
+            }
+            [self preloadUpcomingMediaIfNeeded];
+        }];
+        
         [NSNotificationCenter.defaultCenter addObserver:self
                                                selector:@selector(reachabilityDidChange:)
                                                    name:FXReachabilityStatusDidChangeNotification
@@ -299,9 +523,21 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
     self.updateTimer = nil;
     self.startDateTimer = nil;
     self.endDateTimer = nil;
+    self.startDatePrefetchTimer = nil;
+    self.startDatePreparationTimer = nil;
     self.livestreamEndDateTimer = nil;
     self.socialCountViewTimer = nil;
     self.continuousPlaybackTransitionTimer = nil;
+    self.reconnectionTimer = nil;
+    
+    [self.preloadImageOperation cancel];
+    [self.mediaPlayerController removePeriodicTimeObserver:self.preloadTimeObserver];
+    [self cancelChapterPrefetching];
+    
+    // The player budget might now allow a parked controller to be restored
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [SRGLetterboxController updatePlayerBudget];
+    });
 }
 
 #pragma mark Getters and setters
@@ -362,6 +598,12 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
     return self.mediaPlayerController.timeRange;
 }
 
+- (void)setPriority:(SRGLetterboxControllerPriority)priority
+{
+    _priority = priority;
+    [SRGLetterboxController updatePlayerBudget];
+}
+
 - (void)setMuted:(BOOL)muted
 {
     _muted = muted;
@@ -487,6 +729,8 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
     self.updateTimer = [NSTimer srgletterbox_timerWithTimeInterval:updateInterval repeats:YES block:^(NSTimer * _Nonnull timer) {
         @strongify(self)
         
+        [self preloadZappingChannels];
+        
         [self updateMetadataWithCompletionBlock:^(NSError *error, NSError *previousError) {
             if (error) {
                 [self stop];
@@ -546,6 +790,29 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
     _endDateTimer = endDateTimer;
 }
 
+- (void)setStartDatePrefetchTimer:(NSTimer *)startDatePrefetchTimer
+{
+    [_startDatePrefetchTimer invalidate];
+    _startDatePrefetchTimer = startDatePrefetchTimer;
+}
+
+- (void)setStartDatePreparationTimer:(NSTimer *)startDatePreparationTimer
+{
+    [_startDatePreparationTimer invalidate];
+    _startDatePreparationTimer = startDatePreparationTimer;
+}
+
+- (void)setScheduledUpdateLead:(NSTimeInterval)scheduledUpdateLead
+{
+    _scheduledUpdateLead = fmin(fmax(scheduledUpdateLead, 0.), SRGLetterboxMaximumScheduledUpdateSpread);
+    _scheduledUpdateWindow = fmin(_scheduledUpdateWindow, SRGLetterboxMaximumScheduledUpdateSpread - _scheduledUpdateLead);
+}
+
+- (void)setScheduledUpdateWindow:(NSTimeInterval)scheduledUpdateWindow
+{
+    _scheduledUpdateWindow = fmin(fmax(scheduledUpdateWindow, 0.), SRGLetterboxMaximumScheduledUpdateSpread - _scheduledUpdateLead);
+}
+
 - (void)setLivestreamEndDateTimer:(NSTimer *)livestreamEndDateTimer
 {
     [_livestreamEndDateTimer invalidate];
@@ -558,6 +825,12 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
     _socialCountViewTimer = socialCountViewTimer;
 }
 
+- (void)setReconnectionTimer:(NSTimer *)reconnectionTimer
+{
+    [_reconnectionTimer invalidate];
+    _reconnectionTimer = reconnectionTimer;
+}
+
 - (void)setContinuousPlaybackTransitionTimer:(NSTimer *)continuousPlaybackTransitionTimer
 {
     [_continuousPlaybackTransitionTimer invalidate];
@@ -687,12 +960,11 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
 
 - (SRGPosition *)startPositionForMedia:(SRGMedia *)media
 {
+    SRGPosition *position = nil;
     if ([self.playlistDataSource respondsToSelector:@selector(controller:startPositionForMedia:)]) {
-        return [self.playlistDataSource controller:self startPositionForMedia:media];
-    }
-    else {
-        return nil;
+        position = [self.playlistDataSource controller:self startPositionForMedia:media];
     }
+    return position ?: [self.positionStore positionForURN:media.URN];
 }
 
 - (SRGLetterboxPlaybackSettings *)preferredSettingsForMedia:(SRGMedia *)media
@@ -763,9 +1035,47 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
     // Schedule an update when the media starts
     NSTimeInterval startTimeInterval = [media.startDate timeIntervalSinceNow];
     if (startTimeInterval > 0.) {
+        // Retrieve metadata ahead of time, at a random time within the update window. The data is kept by the media
+        // composition preloader and used to start playback locally at the exact start date.
+        NSTimeInterval prefetchTimeInterval = startTimeInterval - self.scheduledUpdateLead - self.scheduledUpdateWindow * self.scheduledUpdateWindowFraction;
+        if (self.scheduledUpdateLead + self.scheduledUpdateWindow > 0. && ! self.contentURLOverridden) {
+            @weakify(self)
+            self.startDatePrefetchTimer = [NSTimer srgletterbox_timerWithTimeInterval:fmax(prefetchTimeInterval, 0.) repeats:NO block:^(NSTimer * _Nonnull timer) {
+                @strongify(self)
+                if (self.URN && self.dataProvider) {
+                    [self.mediaCompositionPreloader preloadMediaCompositionForURN:self.URN standalone:self.preferredSettings.standalone withDataProvider:self.dataProvider];
+                }
+            }];
+        }
+        else {
+            self.startDatePrefetchTimer = nil;
+        }
+        
+        if (self.startDatePreparationInterval > 0. && ! self.contentURLOverridden) {
+            @weakify(self)
+            self.startDatePreparationTimer = [NSTimer srgletterbox_timerWithTimeInterval:fmax(startTimeInterval - self.startDatePreparationInterval, 0.) repeats:NO block:^(NSTimer * _Nonnull timer) {
+                @strongify(self)
+                [self prepareForStartDate];
+            }];
+        }
+        else {
+            self.startDatePreparationTimer = nil;
+        }
+        
         @weakify(self)
         self.startDateTimer = [NSTimer srgletterbox_timerWithTimeInterval:startTimeInterval repeats:NO block:^(NSTimer * _Nonnull timer) {
             @strongify(self)
+            
+            if ([self startPreparedPlayback]) {
+                return;
+            }
+            
+            // Use metadata retrieved ahead of time if available
+            if (self.dataProvider && [self.mediaCompositionPreloader mediaCompositionForURN:self.URN standalone:self.preferredSettings.standalone]) {
+                [self playMedia:self.media atPosition:self.startPosition withPreferredSettings:self.preferredSettings];
+                return;
+            }
+            
             [self updateMetadataWithCompletionBlock:^(NSError *error, NSError *previousError) {
                 if (error) {
                     [self stop];
@@ -778,6 +1088,8 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
     }
     else {
         self.startDateTimer = nil;
+        self.startDatePrefetchTimer = nil;
+        self.startDatePreparationTimer = nil;
     }
     
     // Schedule an update when the media ends
@@ -791,7 +1103,12 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
             [self notifyLivestreamEndWithMedia:self.mediaComposition.srgletterbox_liveMedia previousMedia:self.mediaComposition.srgletterbox_liveMedia];
             [self stop];
             
-            [self updateMetadataWithCompletionBlock:nil];
+            // Refresh metadata at a random time within the update window
+            NSTimeInterval updateTimeInterval = self.scheduledUpdateWindow * self.scheduledUpdateWindowFraction;
+            self.endDateTimer = [NSTimer srgletterbox_timerWithTimeInterval:updateTimeInterval repeats:NO block:^(NSTimer * _Nonnull timer) {
+                @strongify(self)
+                [self updateMetadataWithCompletionBlock:nil];
+            }];
         }];
     }
     else {
@@ -887,7 +1204,31 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
         return;
     }
     
-    SRGRequest *mediaCompositionRequest = [self.dataProvider mediaCompositionForURN:self.URN standalone:self.preferredSettings.standalone withCompletionBlock:^(SRGMediaComposition * _Nullable mediaComposition, NSHTTPURLResponse * _Nullable HTTPResponse, NSError * _Nullable error) {
+    // Clips are not available anymore after their end date, in which case the full-length media composition is required
+    // (see below). Near the end date, retrieve it in parallel to avoid a second round trip.
+    __block SRGLetterboxHedgedMediaCompositionRequest *fullLengthMediaCompositionRequest = nil;
+    __block BOOL fullLengthMediaCompositionReceived = NO;
+    __block SRGMediaComposition *fullLengthMediaComposition = nil;
+    __block NSHTTPURLResponse *fullLengthHTTPResponse = nil;
+    __block NSError *fullLengthError = nil;
+    __block SRGMediaCompositionCompletionBlock fullLengthMediaCompositionCompletionBlock = nil;
+    
+    NSString *fullLengthURN = self.mediaComposition.fullLengthMedia.URN;
+    if (fullLengthURN && ! [fullLengthURN isEqual:self.URN] && self.media.endDate && [self.media.endDate timeIntervalSinceNow] < self.updateInterval) {
+        fullLengthMediaCompositionRequest = [self requestMediaCompositionForURN:fullLengthURN standalone:self.preferredSettings.standalone withCompletionBlock:^(SRGMediaComposition * _Nullable mediaComposition, NSHTTPURLResponse * _Nullable HTTPResponse, NSError * _Nullable error) {
+            fullLengthMediaCompositionReceived = YES;
+            fullLengthMediaComposition = mediaComposition;
+            fullLengthHTTPResponse = HTTPResponse;
+            fullLengthError = error;
+            
+            if (fullLengthMediaCompositionCompletionBlock) {
+                fullLengthMediaCompositionCompletionBlock(mediaComposition, HTTPResponse, error);
+                fullLengthMediaCompositionCompletionBlock = nil;
+            }
+        }];
+    }
+    
+    [self requestMediaCompositionForURN:self.URN standalone:self.preferredSettings.standalone withCompletionBlock:^(SRGMediaComposition * _Nullable mediaComposition, NSHTTPURLResponse * _Nullable HTTPResponse, NSError * _Nullable error) {
         SRGMediaCompositionCompletionBlock mediaCompositionCompletionBlock = ^(SRGMediaComposition * _Nullable mediaComposition, NSHTTPURLResponse * _Nullable HTTPResponse, NSError * _Nullable error) {
             SRGMediaComposition *previousMediaComposition = self.mediaComposition;
             
@@ -896,6 +1237,7 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
             
             // Update metadata if retrieved, otherwise perform a check with the metadata we already have
             if (mediaComposition) {
+                self.mediaCompositionDate = NSDate.date;
                 self.mediaPlayerController.mediaComposition = mediaComposition;
                 [self updateWithURN:nil media:nil mediaComposition:mediaComposition subdivision:self.subdivision channel:self.channel];
             }
@@ -924,17 +1266,7 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
                 
 #if TARGET_OS_IOS
                 if (! self.spriteSheetImage) {
-                    SRGRequest *spriteSheetRequest = [SRGLetterboxController spriteSheetRequestForMediaComposition:mediaComposition withCompletionBlock:^(UIImage * _Nullable image, NSURLResponse * _Nullable response, NSError * _Nullable error) {
-                        if (! error) {
-                            self.spriteSheetImage = image;
-                        }
-                    }];
-                    if (spriteSheetRequest) {
-                        [self.requestQueue addRequest:spriteSheetRequest resume:YES];
-                    }
-                    else {
-                        self.spriteSheetImage = nil;
-                    }
+                    [self updateSpriteSheetForMediaComposition:mediaComposition];
                 }
 #endif
             }
@@ -944,16 +1276,37 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
         
         if ([error.domain isEqualToString:SRGNetworkErrorDomain] && error.code == SRGNetworkErrorHTTP && [error.userInfo[SRGNetworkHTTPStatusCodeKey] integerValue] == 404
                 && self.mediaComposition && ! [self.mediaComposition.fullLengthMedia.URN isEqual:self.URN]) {
-            SRGRequest *fullLengthMediaCompositionRequest = [self.dataProvider mediaCompositionForURN:self.mediaComposition.fullLengthMedia.URN
-                                                                                           standalone:self.preferredSettings.standalone
-                                                                                  withCompletionBlock:mediaCompositionCompletionBlock];
-            [self.requestQueue addRequest:fullLengthMediaCompositionRequest resume:YES];
+            if (! fullLengthMediaCompositionRequest || ! [fullLengthURN isEqual:self.mediaComposition.fullLengthMedia.URN]) {
+                [fullLengthMediaCompositionRequest cancel];
+                [self requestMediaCompositionForURN:self.mediaComposition.fullLengthMedia.URN
+                                         standalone:self.preferredSettings.standalone
+                                withCompletionBlock:mediaCompositionCompletionBlock];
+            }
+            else if (fullLengthMediaCompositionReceived) {
+                mediaCompositionCompletionBlock(fullLengthMediaComposition, fullLengthHTTPResponse, fullLengthError);
+            }
+            else {
+                fullLengthMediaCompositionCompletionBlock = mediaCompositionCompletionBlock;
+            }
         }
         else {
+            [fullLengthMediaCompositionRequest cancel];
             mediaCompositionCompletionBlock(mediaComposition, HTTPResponse, error);
         }
     }];
-    [self.requestQueue addRequest:mediaCompositionRequest resume:YES];
+}
+
+// Retrieve a media composition, sending a second request if it takes too long and hedging is enabled. The request is
+// cancelled with the request queue, or individually using the returned object.
+- (SRGLetterboxHedgedMediaCompositionRequest *)requestMediaCompositionForURN:(NSString *)URN standalone:(BOOL)standalone withCompletionBlock:(SRGMediaCompositionCompletionBlock)completionBlock
+{
+    SRGLetterboxHedgedMediaCompositionRequest *request = [[SRGLetterboxHedgedMediaCompositionRequest alloc] initWithURN:URN
+                                                                                                             standalone:standalone
+                                                                                                           dataProvider:self.dataProvider
+                                                                                                      hedgingPercentile:self.mediaCompositionHedgingPercentile
+                                                                                                        completionBlock:completionBlock];
+    [request resumeInRequestQueue:self.requestQueue];
+    return request;
 }
 
 - (void)updateWithError:(NSError *)error
@@ -1022,6 +1375,29 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
     }] requestWithOptions:SRGRequestOptionBackgroundCompletionEnabled];
 }
 
+- (void)updateSpriteSheetForMediaComposition:(SRGMediaComposition *)mediaComposition
+{
+    // Sprite sheets of adjacent chapters might have been prefetched
+    NSURL *spriteSheetURL = mediaComposition.mainChapter.spriteSheet.URL;
+    UIImage *spriteSheetImage = spriteSheetURL ? [self.spriteSheetImageCache objectForKey:spriteSheetURL] : nil;
+    if (spriteSheetImage) {
+        self.spriteSheetImage = spriteSheetImage;
+        return;
+    }
+    
+    SRGRequest *spriteSheetRequest = [SRGLetterboxController spriteSheetRequestForMediaComposition:mediaComposition withCompletionBlock:^(UIImage * _Nullable image, NSURLResponse * _Nullable response, NSError * _Nullable error) {
+        if (! error) {
+            self.spriteSheetImage = image;
+        }
+    }];
+    if (spriteSheetRequest) {
+        [self.requestQueue addRequest:spriteSheetRequest resume:YES];
+    }
+    else {
+        self.spriteSheetImage = nil;
+    }
+}
+
 - (CGRect)spriteSheetThumbnailRectAtTime:(CMTime)time
 {
     SRGSpriteSheet *spriteSheet = self.mediaComposition.mainChapter.spriteSheet;
@@ -1101,6 +1477,15 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
         return;
     }
     
+    // Resume where playback was left off if no position has been specified
+    if (! position) {
+        position = [self.positionStore positionForURN:URN];
+    }
+    
+    // Use the media composition if retrieved ahead of time (must be done before the reset, which discards it)
+    SRGMediaComposition *preloadedMediaComposition = [self.mediaCompositionPreloader mediaCompositionForURN:URN standalone:preferredSettings.standalone];
+    NSDate *preloadedMediaCompositionDate = [self.mediaCompositionPreloader retrievalDateForURN:URN standalone:preferredSettings.standalone];
+    
     [self resetWithURN:URN media:media];
     
     // Save the settings for restarting after connection loss
@@ -1110,6 +1495,8 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
     preferredSettings = preferredSettings.copy;
     self.preferredSettings = preferredSettings;
     
+    [self preloadZappingChannels];
+    
     @weakify(self)
     self.requestQueue = [[SRGRequestQueue alloc] init];
     
@@ -1124,7 +1511,7 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
     
     [[self.report informationForKey:@"ilResult"] startTimeMeasurementForKey:@"duration"];
     
-    SRGRequest *mediaCompositionRequest = [self.dataProvider mediaCompositionForURN:self.URN standalone:preferredSettings.standalone withCompletionBlock:^(SRGMediaComposition * _Nullable mediaComposition, NSHTTPURLResponse * _Nullable HTTPResponse, NSError * _Nullable error) {
+    SRGMediaCompositionCompletionBlock mediaCompositionCompletionBlock = ^(SRGMediaComposition * _Nullable mediaComposition, NSHTTPURLResponse * _Nullable HTTPResponse, NSError * _Nullable error) {
         @strongify(self)
         
         [[self.report informationForKey:@"ilResult"] stopTimeMeasurementForKey:@"duration"];
@@ -1142,20 +1529,15 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
         // Update screenType value after metadata update.
         [self.report setString:self.usingAirPlay ? @"airplay" : @"local" forKey:@"screenType"];
         
+        // Media compositions retrieved ahead of time might already be a bit old
+        self.mediaCompositionDate = (mediaComposition == preloadedMediaComposition) ? preloadedMediaCompositionDate : NSDate.date;
+        self.metadataStale = NO;
         [self updateWithURN:nil media:nil mediaComposition:mediaComposition subdivision:mediaComposition.mainSegment channel:nil];
         
+        [SRGLetterboxMediaCompositionStore.sharedStore storeMediaComposition:mediaComposition forURN:URN standalone:preferredSettings.standalone];
+        
 #if TARGET_OS_IOS
-        SRGRequest *spriteSheetRequest = [SRGLetterboxController spriteSheetRequestForMediaComposition:mediaComposition withCompletionBlock:^(UIImage * _Nullable image, NSURLResponse * _Nullable response, NSError * _Nullable error) {
-            if (! error) {
-                self.spriteSheetImage = image;
-            }
-        }];
-        if (spriteSheetRequest) {
-            [self.requestQueue addRequest:spriteSheetRequest resume:YES];
-        }
-        else {
-            self.spriteSheetImage = nil;
-        }
+        [self updateSpriteSheetForMediaComposition:mediaComposition];
 #endif
         
         SRGMedia *media = [mediaComposition mediaForSubdivision:mediaComposition.mainChapter];
@@ -1200,8 +1582,23 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
             [self.report stopTimeMeasurementForKey:@"duration"];
             [self.report finish];
         }
-    }];
-    [self.requestQueue addRequest:mediaCompositionRequest resume:YES];
+    };
+    
+    if (preloadedMediaComposition) {
+        SRGLetterboxLogDebug(@"controller", @"Using preloaded media composition for %@", URN);
+        mediaCompositionCompletionBlock(preloadedMediaComposition, nil, nil);
+    }
+    else {
+        // Display metadata stored during a previous session (if any) until fresh metadata has been retrieved
+        SRGMediaComposition *storedMediaComposition = [SRGLetterboxMediaCompositionStore.sharedStore mediaCompositionForURN:URN standalone:preferredSettings.standalone];
+        if (storedMediaComposition) {
+            SRGLetterboxLogDebug(@"controller", @"Using stored media composition for %@ until revalidated", URN);
+            self.metadataStale = YES;
+            [self updateWithURN:nil media:nil mediaComposition:storedMediaComposition subdivision:storedMediaComposition.mainSegment channel:nil];
+        }
+        
+        [self requestMediaCompositionForURN:self.URN standalone:preferredSettings.standalone withCompletionBlock:mediaCompositionCompletionBlock];
+    }
 }
 
 // Checks whether an override has been defined for the specified content to be played. Returns `YES` and plays it iff this is the case.
@@ -1269,7 +1666,22 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
 
 - (void)play
 {
-    if (self.mediaPlayerController.contentURL) {
+    if (self.parked) {
+        self.resumesAfterUnparking = YES;
+        self.lastActivationDate = NSDate.date;
+        [SRGLetterboxController updatePlayerBudget];
+        
+        if (self.parked) {
+            SRGLetterboxLogInfo(@"controller", @"Playback cannot be restored for %@, as the player budget is exhausted by controllers with higher priority.", self.URN);
+        }
+    }
+    else if (self.mediaPlayerController.contentURL) {
+        // Content prepared ahead of its start date must not be played before it
+        if (self.preparedForStartDate || SRGBlockingReasonErrorForMedia(self.media, NSDate.date)) {
+            SRGLetterboxLogInfo(@"controller", @"Playback of %@ cannot be started, as the media is not available yet.", self.URN);
+            return;
+        }
+        
         self.error = nil;
         [self.mediaPlayerController play];
     }
@@ -1283,6 +1695,8 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
 
 - (void)pause
 {
+    self.resumesAfterUnparking = NO;
+    
     // Do not let pause live streams, stop playback
     if (self.mediaPlayerController.streamType == SRGMediaPlayerStreamTypeLive) {
         [self stop];
@@ -1306,7 +1720,13 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
 {
     // Reset the player, including the attached URL. We keep the Letterbox controller context so that playback can
     // be restarted.
+    [self savePosition];
+    
+    self.parked = NO;
+    self.resumesAfterUnparking = NO;
     [self.mediaPlayerController reset];
+    
+    [self updatePlayerBudgetRegistration];
 }
 
 - (void)retry
@@ -1317,8 +1737,12 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
         }
     };
     
-    // Reuse the media if available (so that the information already available to clients is not reduced)
-    if (self.media) {
+    // Only rebuild the player if possible. Otherwise reuse the media if available (so that the information already available
+    // to clients is not reduced)
+    if ([self canRetryWithoutReloading]) {
+        [self retryWithoutReloadingWithCompletionHandler:prepareToPlayCompletionHandler];
+    }
+    else if (self.media) {
         [self prepareToPlayMedia:self.media atPosition:self.startPosition withPreferredSettings:self.preferredSettings completionHandler:prepareToPlayCompletionHandler];
     }
     else if (self.URN) {
@@ -1328,6 +1752,46 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
     [NSNotificationCenter.defaultCenter postNotificationName:SRGLetterboxPlaybackDidRetryNotification object:self];
 }
 
+// Transient network errors do not invalidate the media composition, provided it can still be used
+- (BOOL)canRetryWithoutReloading
+{
+    if (self.parked || ! self.error.srg_letterboxTransientNetworkError) {
+        return NO;
+    }
+    
+    return [self canPlayAvailableMediaComposition];
+}
+
+// The media composition can be played again without being retrieved, provided it was retrieved recently enough and
+// the media is not blocked meanwhile
+- (BOOL)canPlayAvailableMediaComposition
+{
+    if (! self.mediaComposition || ! self.mediaCompositionDate || self.contentURLOverridden) {
+        return NO;
+    }
+    
+    if ([NSDate.date timeIntervalSinceDate:self.mediaCompositionDate] > SRGLetterboxRetriedMediaCompositionMaximumAge) {
+        return NO;
+    }
+    
+    return SRGBlockingReasonErrorForMedia(self.media, NSDate.date) == nil;
+}
+
+// Prepare the player again at the last known position. Metadata, sprite sheet and subdivision information are kept.
+- (void)retryWithoutReloadingWithCompletionHandler:(void (^)(void))completionHandler
+{
+    SRGLetterboxLogInfo(@"controller", @"Retrying playback of %@ with the available media composition.", self.URN);
+    
+    // The start position is kept for later restarts
+    SRGPosition *position = CMTIME_IS_VALID(self.lastPlaybackTime) ? [SRGPosition positionAtTime:self.lastPlaybackTime] : self.startPosition;
+    
+    [self updateWithError:nil];
+    
+    if (! [self.mediaPlayerController prepareToPlayMediaComposition:self.mediaComposition atPosition:position withPreferredSettings:SRGPlaybackSettingsFromLetterboxPlaybackSettings(self.preferredSettings) userInfo:nil completionHandler:completionHandler]) {
+        [self prepareToPlayMedia:self.media atPosition:position withPreferredSettings:self.preferredSettings completionHandler:completionHandler];
+    }
+}
+
 - (void)restart
 {
     [self stop];
@@ -1341,10 +1805,10 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
 
 - (void)resetWithURN:(NSString *)URN media:(SRGMedia *)media
 {
+    [self savePosition];
+    
     if (URN) {
-        self.dataProvider = [[SRGDataProvider alloc] initWithServiceURL:self.serviceURL];
-        self.dataProvider.globalHeaders = self.globalHeaders;
-        self.dataProvider.globalParameters = self.globalParameters;
+        self.dataProvider = SRGLetterboxSharedDataProvider(self.serviceURL, self.globalHeaders, self.globalParameters);
     }
     else {
         self.dataProvider = nil;
@@ -1356,22 +1820,35 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
     self.error = nil;
     
     self.lastUpdateDate = nil;
+    self.mediaCompositionDate = nil;
+    self.metadataStale = NO;
+    self.lastPlaybackTime = kCMTimeInvalid;
     self.dataAvailability = SRGLetterboxDataAvailabilityNone;
     
     self.startPosition = nil;
+    self.parkedPosition = nil;
     self.preferredSettings = nil;
     
     self.socialCountViewURN = nil;
     self.socialCountViewTimer = nil;
+    self.reconnectionTimer = nil;
     
     self.report = nil;
     
+    self.parked = NO;
+    self.resumesAfterUnparking = NO;
+    self.preparedForStartDate = NO;
+    
+    [self discardPreloadedMedia];
+    [self cancelChapterPrefetching];
     [self cancelContinuousPlayback];
     
     [self updateWithURN:URN media:media mediaComposition:nil subdivision:nil channel:nil];
     
     [self.mediaPlayerController reset];
     [self.requestQueue cancel];
+    
+    [self updatePlayerBudgetRegistration];
 }
 
 - (void)seekToPosition:(SRGPosition *)position withCompletionHandler:(void (^)(BOOL))completionHandler
@@ -1406,11 +1883,35 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
     }
     
     SRGMediaPlayerController *mediaPlayerController = self.mediaPlayerController;
+    BOOL playerActive = (mediaPlayerController.playbackState != SRGMediaPlayerPlaybackStateIdle
+                         && mediaPlayerController.playbackState != SRGMediaPlayerPlaybackStatePreparing);
     
+    // Playing another chapter delivered with the stream being played (e.g. a full-length broadcast split into chapters).
+    // Seek to it and update metadata in place, avoiding a teardown and rebuffering
+    if ([subdivision isKindOfClass:SRGChapter.class] && playerActive && [self canSeamlesslySwitchToChapter:(SRGChapter *)subdivision inMediaComposition:mediaComposition]) {
+        SRGChapter *chapter = (SRGChapter *)subdivision;
+        
+#if TARGET_OS_IOS
+        if (! [mediaComposition.mainChapter isEqual:self.mediaComposition.mainChapter]) {
+            [self updateSpriteSheetForMediaComposition:mediaComposition];
+        }
+#endif
+        
+        self.socialCountViewURN = nil;
+        self.socialCountViewTimer = nil;
+        
+        mediaPlayerController.mediaComposition = mediaComposition;
+        [self updateWithURN:nil media:nil mediaComposition:mediaComposition subdivision:chapter channel:nil];
+        
+        CMTime time = [chapter.srg_markRange timeRangeForMediaPlayerController:mediaPlayerController].start;
+        SRGPosition *position = [SRGPosition positionAtTime:time];
+        [mediaPlayerController seekToPosition:position withCompletionHandler:^(BOOL finished) {
+            [mediaPlayerController play];
+            completionHandler ? completionHandler(finished) : nil;
+        }];
+    }
     // If playing another media or if the player is not playing, restart
-    if ([subdivision isKindOfClass:SRGChapter.class]
-            || mediaPlayerController.playbackState == SRGMediaPlayerPlaybackStateIdle
-            || mediaPlayerController.playbackState == SRGMediaPlayerPlaybackStatePreparing) {
+    else if ([subdivision isKindOfClass:SRGChapter.class] || ! playerActive) {
         NSError *blockingReasonError = SRGBlockingReasonErrorForMedia([mediaComposition mediaForSubdivision:mediaComposition.mainChapter], NSDate.date);
         [self updateWithError:blockingReasonError];
         
@@ -1420,17 +1921,7 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
         
 #if TARGET_OS_IOS
         if (! [mediaComposition.mainChapter isEqual:self.mediaComposition.mainChapter]) {
-            SRGRequest *spriteSheetRequest = [SRGLetterboxController spriteSheetRequestForMediaComposition:mediaComposition withCompletionBlock:^(UIImage * _Nullable image, NSURLResponse * _Nullable response, NSError * _Nullable error) {
-                if (! error) {
-                    self.spriteSheetImage = image;
-                }
-            }];
-            if (spriteSheetRequest) {
-                [self.requestQueue addRequest:spriteSheetRequest resume:YES];
-            }
-            else {
-                self.spriteSheetImage = nil;
-            }
+            [self updateSpriteSheetForMediaComposition:mediaComposition];
         }
 #endif
         
@@ -1476,12 +1967,567 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
     return YES;
 }
 
-#pragma mark Playback (convenience)
+// Return `YES` iff the specified chapter is delivered with the stream being played, and can be played
+- (BOOL)canSeamlesslySwitchToChapter:(SRGChapter *)chapter inMediaComposition:(SRGMediaComposition *)mediaComposition
+{
+    if (self.contentURLOverridden || [chapter isEqual:self.mediaComposition.mainChapter]) {
+        return NO;
+    }
+    
+    NSURL *URL = self.mediaPlayerController.resource.URL;
+    if (! URL || ! [[chapter.playableResources valueForKey:@keypath(SRGResource.new, URL)] containsObject:URL]) {
+        return NO;
+    }
+    
+    return SRGBlockingReasonErrorForMedia([mediaComposition mediaForSubdivision:mediaComposition.mainChapter], NSDate.date) == nil;
+}
 
-- (void)playURN:(NSString *)URN atPosition:(SRGPosition *)position withPreferredSettings:(SRGLetterboxPlaybackSettings *)preferredSettings
+#pragma mark Adjacent chapter prefetching
+
+// Retrieve data for the chapters adjacent to the one being played, so that switching to them starts faster. Their blocking
+// state is already available from the media composition.
+- (void)prefetchAdjacentChapters
 {
-    @weakify(self)
-    [self prepareToPlayURN:URN atPosition:position withPreferredSettings:preferredSettings completionHandler:^{
+    SRGMediaComposition *mediaComposition = self.mediaComposition;
+    SRGChapter *mainChapter = mediaComposition.mainChapter;
+    if (! mainChapter || [mainChapter.URN isEqualToString:self.prefetchedChapterURN] || self.contentURLOverridden) {
+        return;
+    }
+    
+    [self cancelChapterPrefetching];
+    self.prefetchedChapterURN = mainChapter.URN;
+    
+    NSArray<SRGChapter *> *chapters = mediaComposition.chapters;
+    NSUInteger index = [chapters indexOfObject:mainChapter];
+    if (index == NSNotFound || chapters.count < 2) {
+        return;
+    }
+    
+    NSMutableArray<SRGChapter *> *adjacentChapters = [NSMutableArray array];
+    if (index > 0) {
+        [adjacentChapters addObject:chapters[index - 1]];
+    }
+    if (index + 1 < chapters.count) {
+        [adjacentChapters addObject:chapters[index + 1]];
+    }
+    
+    NSURL *URL = self.mediaPlayerController.resource.URL;
+    
+    self.chapterPrefetchRequestQueue = [[SRGRequestQueue alloc] init];
+    NSMutableArray<NSURLSessionTask *> *playlistPrefetchTasks = [NSMutableArray array];
+    
+    for (SRGChapter *chapter in adjacentChapters) {
+        NSArray<SRGResource *> *resources = chapter.playableResources;
+        
+        // Chapters sharing the stream being played are switched to seamlessly
+        if (resources.count == 0 || (URL && [[resources valueForKey:@keypath(SRGResource.new, URL)] containsObject:URL])) {
+            continue;
+        }
+        
+#if TARGET_OS_IOS
+        NSURL *spriteSheetURL = chapter.spriteSheet.URL;
+        if (spriteSheetURL && ! [self.spriteSheetImageCache objectForKey:spriteSheetURL]) {
+            SRGMediaComposition *chapterMediaComposition = [mediaComposition mediaCompositionForSubdivision:chapter];
+            SRGRequest *spriteSheetRequest = [SRGLetterboxController spriteSheetRequestForMediaComposition:chapterMediaComposition withCompletionBlock:^(UIImage * _Nullable image, NSURLResponse * _Nullable response, NSError * _Nullable error) {
+                if (image) {
+                    [self.spriteSheetImageCache setObject:image forKey:spriteSheetURL];
+                }
+            }];
+            if (spriteSheetRequest) {
+                [self.chapterPrefetchRequestQueue addRequest:spriteSheetRequest resume:YES];
+            }
+        }
+#endif
+        
+        // Retrieve the master playlist at low priority, so that DNS resolution, connection setup and CDN caches are warm
+        // when the chapter is played
+        NSPredicate *predicate = [NSPredicate predicateWithFormat:@"%K == %@", @keypath(SRGResource.new, streamingMethod), @(SRGStreamingMethodHLS)];
+        NSURL *playlistURL = [resources filteredArrayUsingPredicate:predicate].firstObject.URL;
+        if (playlistURL) {
+            NSURLSessionTask *playlistPrefetchTask = [NSURLSession.sharedSession dataTaskWithURL:playlistURL];
+            playlistPrefetchTask.priority = NSURLSessionTaskPriorityLow;
+            [playlistPrefetchTask resume];
+            [playlistPrefetchTasks addObject:playlistPrefetchTask];
+        }
+    }
+    
+    self.playlistPrefetchTasks = playlistPrefetchTasks.copy;
+}
+
+- (void)cancelChapterPrefetching
+{
+    [self.chapterPrefetchRequestQueue cancel];
+    self.chapterPrefetchRequestQueue = nil;
+    
+    [self.playlistPrefetchTasks makeObjectsPerformSelector:@selector(cancel)];
+    self.playlistPrefetchTasks = nil;
+    
+    self.prefetchedChapterURN = nil;
+}
+
+#pragma mark Upcoming media preloading
+
+- (void)preloadUpcomingMediaIfNeeded
+{
+    SRGMediaPlayerController *mediaPlayerController = self.mediaPlayerController;
+    if (self.upcomingMediaPreloadInterval <= 0. || mediaPlayerController.streamType != SRGMediaPlayerStreamTypeOnDemand) {
+        return;
+    }
+    
+    CMTimeRange timeRange = mediaPlayerController.timeRange;
+    if (CMTIMERANGE_IS_INVALID(timeRange) || CMTIMERANGE_IS_EMPTY(timeRange)) {
+        return;
+    }
+    
+    NSTimeInterval remainingTimeInterval = CMTimeGetSeconds(CMTimeSubtract(CMTimeRangeGetEnd(timeRange), mediaPlayerController.currentTime));
+    if (remainingTimeInterval > self.upcomingMediaPreloadInterval) {
+        return;
+    }
+    
+    SRGMedia *nextMedia = self.nextMedia;
+    if ([self canPlayPlaylistMedia:nextMedia]) {
+        [self preloadMedia:nextMedia];
+    }
+}
+
+// Retrieve the media composition (which also provides the blocking state) and the artwork displayed by the continuous
+// playback user interface
+- (void)preloadMedia:(SRGMedia *)media
+{
+    [self preloadMediaCompositionForMedia:media];
+    [self preloadImageForMedia:media];
+}
+
+- (void)preloadMediaCompositionForMedia:(SRGMedia *)media
+{
+    // Overridden content does not use media compositions
+    if (! self.dataProvider || (self.contentURLOverridingBlock && self.contentURLOverridingBlock(media.URN))) {
+        return;
+    }
+    
+    BOOL standalone = [self preferredSettingsForMedia:media].standalone;
+    [self.mediaCompositionPreloader preloadMediaCompositionForURN:media.URN standalone:standalone withDataProvider:self.dataProvider];
+}
+
+- (void)preloadImageForMedia:(SRGMedia *)media
+{
+    // Sizes used by the continuous playback user interface
+#if TARGET_OS_IOS
+    NSURL *URL = SRGLetterboxImageURL(media.image, SRGImageSizeLarge, self);
+#else
+    NSURL *URL = SRGLetterboxImageURL(media.image, SRGImageSizeMedium, self);
+#endif
+    if (! URL || [URL isEqual:self.preloadedImageURL]) {
+        return;
+    }
+    
+    [self.preloadImageOperation cancel];
+    
+    self.preloadedImageURL = URL;
+    self.preloadImageOperation = [SRGLetterboxImageLoader requestImageWithURL:URL priority:SRGLetterboxImagePriorityUpcoming completion:nil];
+}
+
+- (void)discardPreloadedMedia
+{
+    // Keep channels warm while zapping
+    [self.mediaCompositionPreloader removeMediaCompositionsExceptForURNs:[NSSet setWithArray:self.zappingURNs ?: @[]]];
+    
+    [self.preloadImageOperation cancel];
+    self.preloadImageOperation = nil;
+    self.preloadedImageURL = nil;
+}
+
+#pragma mark Start date preparation
+
+// Prepare the player (paused) for a media which is not available yet. The availability error is kept so that the
+// countdown is still displayed.
+- (void)prepareForStartDate
+{
+    SRGMediaComposition *mediaComposition = [self.mediaCompositionPreloader mediaCompositionForURN:self.URN standalone:self.preferredSettings.standalone] ?: self.mediaComposition;
+    if (! mediaComposition || self.mediaPlayerController.playbackState != SRGMediaPlayerPlaybackStateIdle) {
+        return;
+    }
+    
+    SRGLetterboxLogInfo(@"controller", @"Preparing %@ ahead of its start date.", self.URN);
+    
+    // Resources might not be available yet, in which case the usual path is followed at the start date
+    self.preparedForStartDate = [self.mediaPlayerController prepareToPlayMediaComposition:mediaComposition atPosition:nil withPreferredSettings:SRGPlaybackSettingsFromLetterboxPlaybackSettings(self.preferredSettings) userInfo:nil completionHandler:nil];
+}
+
+// Start playback with the player prepared ahead of time, if any. Return `YES` iff successful, otherwise the prepared
+// player is reset so that the usual path (including blocking checks) is followed.
+- (BOOL)startPreparedPlayback
+{
+    if (! self.preparedForStartDate) {
+        return NO;
+    }
+    
+    self.preparedForStartDate = NO;
+    
+    SRGMediaPlayerController *mediaPlayerController = self.mediaPlayerController;
+    if (mediaPlayerController.playbackState != SRGMediaPlayerPlaybackStatePaused || SRGBlockingReasonErrorForMedia(self.media, NSDate.date)) {
+        [mediaPlayerController reset];
+        return NO;
+    }
+    
+    SRGLetterboxLogInfo(@"controller", @"Starting prepared playback of %@.", self.URN);
+    
+    [self updateWithError:nil];
+    
+    // Buffered content might be late for livestreams with DVR
+    if (mediaPlayerController.streamType == SRGMediaPlayerStreamTypeDVR) {
+        CMTime targetTime = CMTimeRangeGetEnd(mediaPlayerController.timeRange);
+        [mediaPlayerController seekToPosition:[SRGPosition positionAroundTime:targetTime] withCompletionHandler:^(BOOL finished) {
+            [mediaPlayerController play];
+        }];
+    }
+    else {
+        [mediaPlayerController play];
+    }
+    return YES;
+}
+
+#pragma mark Zapping
+
+- (void)setZappingURNs:(NSArray<NSString *> *)zappingURNs
+{
+    _zappingURNs = zappingURNs.copy;
+    [self preloadZappingChannels];
+}
+
+- (NSString *)zappingURNWithOffset:(NSInteger)offset
+{
+    NSArray<NSString *> *zappingURNs = self.zappingURNs;
+    if (! self.URN || zappingURNs.count < 2) {
+        return nil;
+    }
+    
+    NSUInteger index = [zappingURNs indexOfObject:self.URN];
+    if (index == NSNotFound) {
+        return nil;
+    }
+    
+    NSInteger count = zappingURNs.count;
+    return zappingURNs[((NSInteger)index + offset % count + count) % count];
+}
+
+- (NSString *)previousZappingURN
+{
+    return [self zappingURNWithOffset:-1];
+}
+
+- (NSString *)nextZappingURN
+{
+    return [self zappingURNWithOffset:1];
+}
+
+- (BOOL)zapToURN:(NSString *)URN
+{
+    if (! URN) {
+        return NO;
+    }
+    
+    [self playURN:URN atPosition:nil withPreferredSettings:self.preferredSettings];
+    return YES;
+}
+
+- (BOOL)zapToPreviousChannel
+{
+    return [self zapToURN:self.previousZappingURN];
+}
+
+- (BOOL)zapToNextChannel
+{
+    return [self zapToURN:self.nextZappingURN];
+}
+
+// Keep the media compositions of adjacent channels warm. Called again periodically to refresh them.
+- (void)preloadZappingChannels
+{
+    if (! self.dataProvider) {
+        return;
+    }
+    
+    NSMutableOrderedSet<NSString *> *URNs = [NSMutableOrderedSet orderedSet];
+    if (self.nextZappingURN) {
+        [URNs addObject:self.nextZappingURN];
+    }
+    if (self.previousZappingURN) {
+        [URNs addObject:self.previousZappingURN];
+    }
+    
+    BOOL standalone = self.preferredSettings.standalone;
+    for (NSString *URN in URNs) {
+        if (self.contentURLOverridingBlock && self.contentURLOverridingBlock(URN)) {
+            continue;
+        }
+        [self.mediaCompositionPreloader preloadMediaCompositionForURN:URN standalone:standalone withDataProvider:self.dataProvider];
+    }
+}
+
+#pragma mark Prewarming
+
+- (void)prewarmConnectionsForURN:(NSString *)URN standalone:(BOOL)standalone
+{
+    SRGLetterboxPrewarmConnectionToURL(self.serviceURL);
+    
+    NSURL *streamURL = self.mediaPlayerController.resource.URL;
+    if (! streamURL) {
+        NSString *streamOriginURLString = SRGLetterboxSavedStreamOriginURLString();
+        streamURL = streamOriginURLString ? [NSURL URLWithString:streamOriginURLString] : nil;
+    }
+    SRGLetterboxPrewarmConnectionToURL(streamURL);
+    
+    // Connections used by the data provider itself are only warmed up by actual requests
+    if (URN && ! (self.contentURLOverridingBlock && self.contentURLOverridingBlock(URN))) {
+        SRGDataProvider *dataProvider = SRGLetterboxSharedDataProvider(self.serviceURL, self.globalHeaders, self.globalParameters);
+        [self.mediaCompositionPreloader preloadMediaCompositionForURN:URN standalone:standalone withDataProvider:dataProvider];
+    }
+}
+
+// Save the origin of the stream being played, so that a connection to it can be prewarmed the next time the application starts
+- (void)saveStreamOrigin
+{
+    NSString *streamOriginURLString = SRGLetterboxOriginURL(self.mediaPlayerController.resource.URL).absoluteString;
+    if (! streamOriginURLString) {
+        return;
+    }
+    
+    SRGLetterboxSaveStreamOriginURLString(streamOriginURLString);
+}
+
+#pragma mark Reconnection
+
+- (NSTimeInterval)nextReconnectionDelay
+{
+    if (self.reconnectionDelay <= 0.) {
+        return 0.;
+    }
+    
+    // Exponential backoff, with the delay randomly chosen between its half and its full value
+    NSTimeInterval maximumDelay = fmax(self.maximumReconnectionDelay, self.reconnectionDelay);
+    NSTimeInterval delay = fmin(self.reconnectionDelay * pow(2., fmin(self.reconnectionCount, 16)), maximumDelay);
+    delay *= 0.5 + 0.5 * arc4random_uniform(1001) / 1000.;
+    
+    // Lower priority controllers wait longer (one initial delay per priority step below the high priority)
+    SRGLetterboxControllerPriority priorityDeficit = fmaxf(SRGLetterboxControllerPriorityHigh - self.effectivePriority, 0.f);
+    return delay + priorityDeficit / SRGLetterboxControllerPriorityLow * self.reconnectionDelay;
+}
+
+- (void)scheduleReconnection
+{
+    if (self.reconnectionTimer) {
+        return;
+    }
+    
+    NSTimeInterval delay = [self nextReconnectionDelay];
+    SRGLetterboxLogInfo(@"controller", @"Network reachable again. Reconnecting %@ in %.1f seconds.", self.URN, delay);
+    
+    @weakify(self)
+    self.reconnectionTimer = [NSTimer srgletterbox_timerWithTimeInterval:delay repeats:NO block:^(NSTimer * _Nonnull timer) {
+        @strongify(self)
+        
+        self.reconnectionTimer = nil;
+        self.reconnectionCount += 1;
+        
+        if (self.error.srg_letterboxTransientNetworkError) {
+            [self retry];
+        }
+    }];
+}
+
+#pragma mark Resume positions
+
+// Save the current position of on-demand medias being played
+- (void)savePosition
+{
+    SRGMediaPlayerController *mediaPlayerController = self.mediaPlayerController;
+    SRGMediaPlayerPlaybackState playbackState = mediaPlayerController.playbackState;
+    if (! self.positionStore || ! self.URN || mediaPlayerController.streamType != SRGMediaPlayerStreamTypeOnDemand
+            || playbackState == SRGMediaPlayerPlaybackStateIdle || playbackState == SRGMediaPlayerPlaybackStatePreparing || playbackState == SRGMediaPlayerPlaybackStateEnded) {
+        return;
+    }
+    
+    [self.positionStore saveTime:mediaPlayerController.currentTime forURN:self.URN];
+    self.lastPositionSaveDate = NSDate.date;
+}
+
+#pragma mark Player budget
+
++ (NSUInteger)maximumActivePlayerCount
+{
+    return s_maximumActivePlayerCount;
+}
+
++ (void)setMaximumActivePlayerCount:(NSUInteger)maximumActivePlayerCount
+{
+    s_maximumActivePlayerCount = maximumActivePlayerCount;
+    [self updatePlayerBudget];
+}
+
+// Park or restore controllers so that only the ones with the highest priority (most recently active ones first for
+// equal priorities) have an active player.
++ (void)updatePlayerBudget
+{
+    // Parking and restoring controllers changes their playback state, which itself triggers budget updates
+    static BOOL s_updating = NO;
+    if (s_updating) {
+        return;
+    }
+    
+    s_updating = YES;
+    
+    NSArray<SRGLetterboxController *> *controllers = [SRGLetterboxControllerBudgetedControllers().allObjects sortedArrayUsingComparator:^NSComparisonResult(SRGLetterboxController * _Nonnull controller1, SRGLetterboxController * _Nonnull controller2) {
+        SRGLetterboxControllerPriority priority1 = controller1.effectivePriority;
+        SRGLetterboxControllerPriority priority2 = controller2.effectivePriority;
+        if (priority1 != priority2) {
+            return (priority1 > priority2) ? NSOrderedAscending : NSOrderedDescending;
+        }
+        else {
+            NSDate *lastActivationDate1 = controller1.lastActivationDate ?: NSDate.distantPast;
+            NSDate *lastActivationDate2 = controller2.lastActivationDate ?: NSDate.distantPast;
+            return [lastActivationDate2 compare:lastActivationDate1];
+        }
+    }];
+    
+    NSUInteger maximumActivePlayerCount = (s_maximumActivePlayerCount != 0) ? s_maximumActivePlayerCount : NSUIntegerMax;
+    [controllers enumerateObjectsUsingBlock:^(SRGLetterboxController * _Nonnull controller, NSUInteger idx, BOOL * _Nonnull stop) {
+        if (idx < maximumActivePlayerCount) {
+            if (controller.parked) {
+                [controller unpark];
+            }
+        }
+        else if (! controller.parked && controller.effectivePriority != FLT_MAX) {
+            [controller park];
+        }
+    }];
+    
+    s_updating = NO;
+}
+
+// The controller enabled for background services or in picture in picture always wins
+- (SRGLetterboxControllerPriority)effectivePriority
+{
+#if TARGET_OS_IOS
+    if (self.backgroundServicesEnabled) {
+        return FLT_MAX;
+    }
+#endif
+    
+    if (@available(iOS 12, tvOS 14, *)) {
+        if (self.pictureInPictureActive) {
+            return FLT_MAX;
+        }
+    }
+    
+    return self.priority;
+}
+
+- (void)updatePlayerBudgetRegistration
+{
+    NSHashTable<SRGLetterboxController *> *controllers = SRGLetterboxControllerBudgetedControllers();
+    
+    SRGMediaPlayerPlaybackState playbackState = self.mediaPlayerController.playbackState;
+    if (playbackState != SRGMediaPlayerPlaybackStateIdle || self.parked) {
+        if (playbackState == SRGMediaPlayerPlaybackStatePreparing || playbackState == SRGMediaPlayerPlaybackStatePlaying) {
+            self.lastActivationDate = NSDate.date;
+        }
+        [controllers addObject:self];
+    }
+    else {
+        [controllers removeObject:self];
+    }
+    
+    [SRGLetterboxController updatePlayerBudget];
+}
+
+- (void)park
+{
+    if (! self.URN) {
+        return;
+    }
+    
+    SRGLetterboxLogInfo(@"controller", @"Parking controller %@ to honor the player budget.", self.URN);
+    
+    SRGMediaPlayerController *mediaPlayerController = self.mediaPlayerController;
+    SRGMediaPlayerPlaybackState playbackState = mediaPlayerController.playbackState;
+    self.resumesAfterUnparking = (playbackState == SRGMediaPlayerPlaybackStatePlaying
+                                  || playbackState == SRGMediaPlayerPlaybackStateSeeking
+                                  || playbackState == SRGMediaPlayerPlaybackStateStalled);
+    
+    // Livestreams resume at the live edge. The start position is kept for later restarts.
+    SRGMediaPlayerStreamType streamType = mediaPlayerController.streamType;
+    if (streamType == SRGMediaPlayerStreamTypeOnDemand) {
+        self.parkedPosition = [SRGPosition positionAtTime:mediaPlayerController.currentTime];
+    }
+    else if (streamType == SRGMediaPlayerStreamTypeUnknown) {
+        self.parkedPosition = self.startPosition;
+    }
+    else {
+        self.parkedPosition = nil;
+    }
+    
+    self.parked = YES;
+    [mediaPlayerController reset];
+}
+
+- (void)unpark
+{
+    SRGLetterboxLogInfo(@"controller", @"Restoring parked controller %@.", self.URN);
+    
+    BOOL resumesPlayback = self.resumesAfterUnparking;
+    SRGPosition *position = self.parkedPosition;
+    
+    self.parked = NO;
+    self.resumesAfterUnparking = NO;
+    self.parkedPosition = nil;
+    
+    // Reuse the media composition if still valid, so that no request is required
+    if (! self.error && [self canPlayAvailableMediaComposition]) {
+        NSDictionary<SRGResourceLoaderOption, id> *options = nil;
+        self.report = [self startPlaybackDiagnosticReportForService:SRGLetterboxDiagnosticServiceName withName:self.URN options:&options];
+        [[self.report informationForKey:@"playerResult"] startTimeMeasurementForKey:@"duration"];
+        
+        SRGMediaPlayerController *mediaPlayerController = self.mediaPlayerController;
+        NSDictionary *userInfo = @{ SRGAnalyticsDataProviderUserInfoResourceLoaderOptionsKey : options };
+        if ([mediaPlayerController prepareToPlayMediaComposition:self.mediaComposition atPosition:position withPreferredSettings:SRGPlaybackSettingsFromLetterboxPlaybackSettings(self.preferredSettings) userInfo:userInfo completionHandler:^{
+            [[self.report informationForKey:@"playerResult"] srgletterbox_setPlayerInformationWithContentURL:mediaPlayerController.contentURL error:nil];
+            [[self.report informationForKey:@"playerResult"] stopTimeMeasurementForKey:@"duration"];
+            [self.report stopTimeMeasurementForKey:@"duration"];
+            [self.report finish];
+            
+            if (resumesPlayback) {
+                [mediaPlayerController play];
+            }
+        }]) {
+            return;
+        }
+        
+        self.report = nil;
+    }
+    
+    if (resumesPlayback) {
+        // Load the media again, checking its availability. The start position is kept for later restarts.
+        SRGPosition *startPosition = self.startPosition;
+        if (self.media) {
+            [self playMedia:self.media atPosition:position withPreferredSettings:self.preferredSettings];
+        }
+        else if (self.URN) {
+            [self playURN:self.URN atPosition:position withPreferredSettings:self.preferredSettings];
+        }
+        self.startPosition = startPosition;
+    }
+    else {
+        [SRGLetterboxControllerBudgetedControllers() removeObject:self];
+    }
+}
+
+#pragma mark Playback (convenience)
+
+- (void)playURN:(NSString *)URN atPosition:(SRGPosition *)position withPreferredSettings:(SRGLetterboxPlaybackSettings *)preferredSettings
+{
+    @weakify(self)
+    [self prepareToPlayURN:URN atPosition:position withPreferredSettings:preferredSettings completionHandler:^{
         @strongify(self)
         [self play];
     }];
@@ -1747,8 +2793,11 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
 
 - (void)reachabilityDidChange:(NSNotification *)notification
 {
-    if ([FXReachability sharedInstance].reachable && self.error.srg_letterboxNoNetworkError) {
-        [self retry];
+    if (! [FXReachability sharedInstance].reachable) {
+        self.reconnectionTimer = nil;
+    }
+    else if (self.error.srg_letterboxTransientNetworkError) {
+        [self scheduleReconnection];
     }
 }
 
@@ -1762,6 +2811,21 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
                                                         userInfo:notification.userInfo];
     }
     
+    [self updatePlayerBudgetRegistration];
+    
+    if (playbackState == SRGMediaPlayerPlaybackStatePaused) {
+        [self savePosition];
+    }
+    else if (playbackState == SRGMediaPlayerPlaybackStateEnded && self.URN) {
+        [self.positionStore removePositionForURN:self.URN];
+    }
+    
+    if (playbackState == SRGMediaPlayerPlaybackStatePlaying) {
+        self.reconnectionCount = 0;
+        [self prefetchAdjacentChapters];
+        [self saveStreamOrigin];
+    }
+    
     // Continuous playback only makes sense while in the ended state
     if (playbackState != SRGMediaPlayerPlaybackStateEnded) {
         [self cancelContinuousPlayback];
@@ -1835,6 +2899,9 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
             SRGLetterboxPlaybackSettings *preferredSettings = [self preferredSettingsForMedia:nextMedia];
             
             if (continuousPlaybackTransitionDuration != 0.) {
+                // Retrieve the upcoming media during the transition if not already available
+                [self preloadMedia:nextMedia];
+                
                 self.continuousPlaybackTransitionStartDate = NSDate.date;
                 self.continuousPlaybackTransitionEndDate = [NSDate dateWithTimeIntervalSinceNow:continuousPlaybackTransitionDuration];
                 self.continuousPlaybackUpcomingMedia = nextMedia;
@@ -1886,6 +2953,14 @@ static SRGPlaybackSettings *SRGPlaybackSettingsFromLetterboxPlaybackSettings(SRG
 
 - (void)playbackDidFail:(NSNotification *)notification
 {
+    // Failures while preparing ahead of the start date are silently ignored. Availability information is kept.
+    if (self.preparedForStartDate) {
+        SRGLetterboxLogInfo(@"controller", @"Preparation of %@ ahead of its start date failed.", self.URN);
+        self.preparedForStartDate = NO;
+        [self.mediaPlayerController reset];
+        return;
+    }
+    
     if (self.dataAvailability == SRGLetterboxDataAvailabilityLoading) {
         self.dataAvailability = SRGLetterboxDataAvailabilityLoaded;
     }
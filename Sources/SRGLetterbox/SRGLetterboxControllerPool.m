@@ -0,0 +1,158 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGLetterboxControllerPool.h"
+
+#import "SRGLetterboxLogger.h"
+
+@import UIKit;
+
+@interface SRGLetterboxControllerPool ()
+
+@property (nonatomic) NSUInteger capacity;
+@property (nonatomic, copy) void (^configurationBlock)(SRGLetterboxController *controller);
+
+@property (nonatomic) NSMutableArray<SRGLetterboxController *> *idleControllers;
+@property (nonatomic) NSHashTable<SRGLetterboxController *> *activeControllers;
+
+// The view each controller was last dequeued for
+@property (nonatomic) NSMapTable<SRGLetterboxController *, SRGLetterboxControllerView *> *views;
+
+@end
+
+@implementation SRGLetterboxControllerPool
+
+#pragma mark Object lifecycle
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity configurationBlock:(void (^)(SRGLetterboxController * _Nonnull))configurationBlock
+{
+    if (self = [super init]) {
+        self.capacity = capacity;
+        self.configurationBlock = configurationBlock;
+        self.idleControllers = [NSMutableArray array];
+        
+        // Weak references, so that controllers which are never recycled do not count against the capacity forever
+        self.activeControllers = [NSHashTable weakObjectsHashTable];
+        self.views = [NSMapTable weakToWeakObjectsMapTable];
+        
+        [NSNotificationCenter.defaultCenter addObserver:self
+                                               selector:@selector(applicationDidReceiveMemoryWarning:)
+                                                   name:UIApplicationDidReceiveMemoryWarningNotification
+                                                 object:nil];
+    }
+    return self;
+}
+
+#pragma mark Getters and setters
+
+- (NSUInteger)activeControllerCount
+{
+    return self.activeControllers.allObjects.count;
+}
+
+#pragma mark Controller management
+
+- (SRGLetterboxController *)dequeueController
+{
+    return [self dequeueControllerForView:nil];
+}
+
+- (SRGLetterboxController *)dequeueControllerForView:(SRGLetterboxControllerView *)view
+{
+    SRGLetterboxController *controller = [self idleControllerForView:view];
+    if (controller) {
+        [self.idleControllers removeObject:controller];
+    }
+    else if (self.activeControllerCount < self.capacity) {
+        controller = [[SRGLetterboxController alloc] init];
+        self.configurationBlock ? self.configurationBlock(controller) : nil;
+    }
+    else {
+        SRGLetterboxLogWarning(@"pool", @"The maximum number of controllers (%@) has been reached", @(self.capacity));
+        return nil;
+    }
+    
+    // A controller can only be attached to a single view
+    SRGLetterboxControllerView *previousView = [self.views objectForKey:controller];
+    if (previousView != view) {
+        [self detachController:controller];
+    }
+    
+    if (view) {
+        [self.views setObject:view forKey:controller];
+    }
+    
+    [self.activeControllers addObject:controller];
+    return controller;
+}
+
+// Prefer the controller last used with the view, then controllers not attached to any view
+- (SRGLetterboxController *)idleControllerForView:(SRGLetterboxControllerView *)view
+{
+    if (view) {
+        for (SRGLetterboxController *controller in self.idleControllers) {
+            if ([self.views objectForKey:controller] == view) {
+                return controller;
+            }
+        }
+    }
+    
+    for (SRGLetterboxController *controller in self.idleControllers) {
+        if ([self.views objectForKey:controller].controller != controller) {
+            return controller;
+        }
+    }
+    
+    return self.idleControllers.lastObject;
+}
+
+- (void)detachController:(SRGLetterboxController *)controller
+{
+    SRGLetterboxControllerView *view = [self.views objectForKey:controller];
+    if (view.controller == controller) {
+        view.controller = nil;
+    }
+    [self.views removeObjectForKey:controller];
+}
+
+- (void)recycleController:(SRGLetterboxController *)controller
+{
+    if (! [self.activeControllers containsObject:controller]) {
+        return;
+    }
+    
+    [self.activeControllers removeObject:controller];
+    
+    [controller reset];
+    self.configurationBlock ? self.configurationBlock(controller) : nil;
+    
+    [self.idleControllers addObject:controller];
+}
+
+#pragma mark Notifications
+
+- (void)applicationDidReceiveMemoryWarning:(NSNotification *)notification
+{
+    // Idle controllers can be created again when needed
+    for (SRGLetterboxController *controller in self.idleControllers) {
+        [self detachController:controller];
+    }
+    [self.idleControllers removeAllObjects];
+}
+
+#pragma mark Description
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p; capacity = %@; activeControllerCount = %@; idleControllerCount = %@>",
+            self.class,
+            self,
+            @(self.capacity),
+            @(self.activeControllerCount),
+            @(self.idleControllers.count)];
+}
+
+@end
@@ -57,6 +57,12 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)didAttachToController NS_REQUIRES_SUPER;
 
+/**
+ *  Method called when the controller already attached to the view is set again. Registrations made when the controller
+ *  was attached are still valid and must not be made again.
+ */
+- (void)didReattachToController NS_REQUIRES_SUPER;
+
 /**
  *  Method called when the attached controller updated the associated metadata.
  */
@@ -23,6 +23,14 @@
 
 - (void)setController:(SRGLetterboxController *)controller
 {
+    // Attaching the same controller again (e.g. a controller borrowed from a pool by a reused cell) must not rebuild
+    // observers from scratch
+    if (_controller && _controller == controller) {
+        [self didReattachToController];
+        [self metadataDidChange];
+        return;
+    }
+    
     if (_controller) {
         [self willDetachFromController];
         
@@ -81,6 +89,9 @@
 - (void)didAttachToController
 {}
 
+- (void)didReattachToController
+{}
+
 - (void)metadataDidChange
 {}
 
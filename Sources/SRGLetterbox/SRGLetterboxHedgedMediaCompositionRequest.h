@@ -0,0 +1,66 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+@import SRGDataProvider;
+@import SRGNetwork;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Media composition request which, if no response has been received after a delay derived from the latencies of recent
+ *  requests, sends a duplicate request. The first response received is used and the other request is cancelled.
+ *
+ *  @discussion Latencies are shared by all requests. Must be used from the main thread.
+ */
+@interface SRGLetterboxHedgedMediaCompositionRequest : NSObject
+
+/**
+ *  Latency under which the specified fraction (between 0 and 1) of recent successful requests completed. Returns 0 if
+ *  not enough requests have been made yet.
+ */
++ (NSTimeInterval)latencyForPercentile:(double)percentile;
+
+/**
+ *  Record the latency of a successful request. Latencies are recorded automatically, this method is mostly useful for
+ *  testing purposes.
+ */
++ (void)recordLatency:(NSTimeInterval)latency;
+
+/**
+ *  Forget all recorded latencies.
+ */
++ (void)removeAllLatencies;
+
+/**
+ *  Create a request for the specified URN and standalone setting. A duplicate request is sent if no response has been
+ *  received after the latency for the specified percentile. The request is never duplicated if the percentile is 0,
+ *  but its latency is still recorded.
+ */
+- (instancetype)initWithURN:(NSString *)URN
+                 standalone:(BOOL)standalone
+               dataProvider:(SRGDataProvider *)dataProvider
+          hedgingPercentile:(double)hedgingPercentile
+            completionBlock:(SRGMediaCompositionCompletionBlock)completionBlock;
+
+/**
+ *  Start the request. Underlying requests are added to the specified queue, so that cancelling the queue cancels them.
+ */
+- (void)resumeInRequestQueue:(SRGRequestQueue *)requestQueue;
+
+/**
+ *  Cancel the request and any duplicate which might have been sent. The completion block is not called.
+ */
+- (void)cancel;
+
+@end
+
+@interface SRGLetterboxHedgedMediaCompositionRequest (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
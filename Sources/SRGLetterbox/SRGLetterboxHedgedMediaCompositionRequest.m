@@ -0,0 +1,205 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGLetterboxHedgedMediaCompositionRequest.h"
+
+#import "NSError+SRGLetterbox.h"
+#import "NSTimer+SRGLetterbox.h"
+#import "SRGLetterboxLogger.h"
+
+@import libextobjc;
+
+// Number of recent latencies kept, and minimum number required for hedging
+static const NSUInteger SRGLetterboxMediaCompositionLatencyCount = 50;
+static const NSUInteger SRGLetterboxMediaCompositionMinimumLatencyCount = 10;
+
+// Hedging earlier than this delay would mostly duplicate requests which are about to succeed
+static const NSTimeInterval SRGLetterboxMinimumHedgingDelay = 0.1;
+
+static NSMutableArray<NSNumber *> *SRGLetterboxMediaCompositionLatencies(void)
+{
+    static dispatch_once_t s_onceToken;
+    static NSMutableArray<NSNumber *> *s_latencies;
+    dispatch_once(&s_onceToken, ^{
+        s_latencies = [NSMutableArray array];
+    });
+    return s_latencies;
+}
+
+@interface SRGLetterboxHedgedMediaCompositionRequest ()
+
+@property (nonatomic, copy) NSString *URN;
+@property (nonatomic) BOOL standalone;
+@property (nonatomic) SRGDataProvider *dataProvider;
+@property (nonatomic) double hedgingPercentile;
+@property (nonatomic, copy) SRGMediaCompositionCompletionBlock completionBlock;
+
+@property (nonatomic, weak) SRGRequestQueue *requestQueue;
+
+// Underlying requests are owned by the request queue. Their completion blocks retain the receiver.
+@property (nonatomic) NSHashTable<SRGRequest *> *requests;
+@property (nonatomic) NSTimer *hedgingTimer;
+@property (nonatomic, getter=isFinished) BOOL finished;
+
+@end
+
+@implementation SRGLetterboxHedgedMediaCompositionRequest
+
+#pragma mark Class methods
+
++ (NSTimeInterval)latencyForPercentile:(double)percentile
+{
+    NSArray<NSNumber *> *latencies = SRGLetterboxMediaCompositionLatencies();
+    if (latencies.count < SRGLetterboxMediaCompositionMinimumLatencyCount) {
+        return 0.;
+    }
+    
+    NSArray<NSNumber *> *sortedLatencies = [latencies sortedArrayUsingSelector:@selector(compare:)];
+    double clampedPercentile = fmin(fmax(percentile, 0.), 1.);
+    NSUInteger rank = MAX((NSUInteger)ceil(clampedPercentile * sortedLatencies.count), 1);
+    return sortedLatencies[MIN(rank, sortedLatencies.count) - 1].doubleValue;
+}
+
++ (void)recordLatency:(NSTimeInterval)latency
+{
+    NSMutableArray<NSNumber *> *latencies = SRGLetterboxMediaCompositionLatencies();
+    [latencies addObject:@(latency)];
+    if (latencies.count > SRGLetterboxMediaCompositionLatencyCount) {
+        [latencies removeObjectAtIndex:0];
+    }
+}
+
++ (void)removeAllLatencies
+{
+    [SRGLetterboxMediaCompositionLatencies() removeAllObjects];
+}
+
+#pragma mark Object lifecycle
+
+- (instancetype)initWithURN:(NSString *)URN
+                 standalone:(BOOL)standalone
+               dataProvider:(SRGDataProvider *)dataProvider
+          hedgingPercentile:(double)hedgingPercentile
+            completionBlock:(SRGMediaCompositionCompletionBlock)completionBlock
+{
+    if (self = [super init]) {
+        self.URN = URN;
+        self.standalone = standalone;
+        self.dataProvider = dataProvider;
+        self.hedgingPercentile = hedgingPercentile;
+        self.completionBlock = completionBlock;
+        self.requests = [NSHashTable weakObjectsHashTable];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    self.hedgingTimer = nil;
+}
+
+#pragma mark Getters and setters
+
+- (void)setHedgingTimer:(NSTimer *)hedgingTimer
+{
+    [_hedgingTimer invalidate];
+    _hedgingTimer = hedgingTimer;
+}
+
+#pragma mark Requests
+
+- (void)resumeInRequestQueue:(SRGRequestQueue *)requestQueue
+{
+    self.requestQueue = requestQueue;
+    [self sendRequest];
+    
+    if (self.hedgingPercentile <= 0.) {
+        return;
+    }
+    
+    NSTimeInterval hedgingDelay = [SRGLetterboxHedgedMediaCompositionRequest latencyForPercentile:self.hedgingPercentile];
+    if (hedgingDelay <= 0.) {
+        return;
+    }
+    
+    @weakify(self)
+    self.hedgingTimer = [NSTimer srgletterbox_timerWithTimeInterval:fmax(hedgingDelay, SRGLetterboxMinimumHedgingDelay) repeats:NO block:^(NSTimer * _Nonnull timer) {
+        @strongify(self)
+        
+        // Requests cancelled meanwhile (e.g. with their queue) must not be duplicated
+        if (self.finished || ! [[self.requests.allObjects valueForKey:@keypath(SRGRequest.new, running)] containsObject:@YES]) {
+            return;
+        }
+        
+        SRGLetterboxLogInfo(@"controller", @"No media composition received for %@ after %.2f seconds. Sending a second request.", self.URN, hedgingDelay);
+        [self sendRequest];
+    }];
+}
+
+- (void)cancel
+{
+    self.finished = YES;
+    self.hedgingTimer = nil;
+    
+    for (SRGRequest *request in self.requests.allObjects) {
+        [request cancel];
+    }
+}
+
+- (void)sendRequest
+{
+    NSDate *startDate = NSDate.date;
+    
+    __block __weak SRGRequest *weakRequest = nil;
+    SRGRequest *request = [self.dataProvider mediaCompositionForURN:self.URN standalone:self.standalone withCompletionBlock:^(SRGMediaComposition * _Nullable mediaComposition, NSHTTPURLResponse * _Nullable HTTPResponse, NSError * _Nullable error) {
+        if (self.finished) {
+            return;
+        }
+        
+        // Transient failures (e.g. connection resets or timeouts) must not prevent a duplicate from succeeding
+        if (error.srg_letterboxTransientNetworkError) {
+            for (SRGRequest *otherRequest in self.requests.allObjects) {
+                if (otherRequest != weakRequest && otherRequest.running) {
+                    SRGLetterboxLogInfo(@"controller", @"Media composition request for %@ failed. Waiting for the other request.", self.URN);
+                    return;
+                }
+            }
+        }
+        
+        self.finished = YES;
+        self.hedgingTimer = nil;
+        
+        if (! error) {
+            [SRGLetterboxHedgedMediaCompositionRequest recordLatency:[NSDate.date timeIntervalSinceDate:startDate]];
+        }
+        
+        for (SRGRequest *otherRequest in self.requests.allObjects) {
+            if (otherRequest != weakRequest) {
+                [otherRequest cancel];
+            }
+        }
+        
+        self.completionBlock(mediaComposition, HTTPResponse, error);
+    }];
+    weakRequest = request;
+    
+    [self.requests addObject:request];
+    [self.requestQueue addRequest:request resume:YES];
+}
+
+#pragma mark Description
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p; URN = %@; standalone = %@; hedgingPercentile = %@>",
+            self.class,
+            self,
+            self.URN,
+            @(self.standalone),
+            @(self.hedgingPercentile)];
+}
+
+@end
@@ -0,0 +1,60 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+@import Foundation;
+@import YYWebImage;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Image request priorities, from the highest to the lowest one.
+ */
+typedef NS_ENUM(NSInteger, SRGLetterboxImagePriority) {
+    /**
+     *  Player poster and artwork for the media being played.
+     */
+    SRGLetterboxImagePriorityPoster = 0,
+    /**
+     *  Upcoming media (continuous playback).
+     */
+    SRGLetterboxImagePriorityUpcoming,
+    /**
+     *  Visible cells.
+     */
+    SRGLetterboxImagePriorityVisible,
+    /**
+     *  Images which might be displayed soon.
+     */
+    SRGLetterboxImagePriorityPrefetch
+};
+
+/**
+ *  Letterbox image pipeline. All Letterbox image requests share the same cache, but are performed with a limited
+ *  number of concurrent downloads and according to their priority, so that many cell images cannot starve the player
+ *  poster or the upcoming media image.
+ *
+ *  @discussion Poster and upcoming media images are retrieved on a dedicated queue, so that they never have to wait for
+ *              cell images.
+ */
+@interface SRGLetterboxImageLoader : NSObject
+
+/**
+ *  The image manager to use for requests with the specified priority (e.g. with `-yy_setImageWithURL:...manager:...`).
+ */
++ (YYWebImageManager *)webImageManagerWithPriority:(SRGLetterboxImagePriority)priority;
+
+/**
+ *  Request an image with the specified priority. Cancel the returned operation if the image is not needed anymore.
+ *
+ *  @discussion The completion block is called on a background thread.
+ */
++ (nullable YYWebImageOperation *)requestImageWithURL:(NSURL *)URL
+                                             priority:(SRGLetterboxImagePriority)priority
+                                           completion:(nullable YYWebImageCompletionBlock)completion;
+
+@end
+
+NS_ASSUME_NONNULL_END
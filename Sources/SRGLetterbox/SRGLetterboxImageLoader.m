@@ -0,0 +1,89 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGLetterboxImageLoader.h"
+
+// Maximum number of concurrent downloads for player images (poster, upcoming media) and cell images respectively
+static const NSInteger SRGLetterboxImageLoaderPlayerMaxConcurrentOperationCount = 2;
+static const NSInteger SRGLetterboxImageLoaderCellMaxConcurrentOperationCount = 4;
+
+/**
+ *  Image manager assigning its priority to the operations it creates.
+ */
+@interface SRGLetterboxWebImageManager : YYWebImageManager
+
+@property (nonatomic) NSOperationQueuePriority queuePriority;
+@property (nonatomic) NSQualityOfService qualityOfService;
+
+@end
+
+@implementation SRGLetterboxImageLoader
+
+#pragma mark Class methods
+
++ (YYWebImageManager *)webImageManagerWithPriority:(SRGLetterboxImagePriority)priority
+{
+    static NSDictionary<NSNumber *, YYWebImageManager *> *s_webImageManagers;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        // Share the cache with the default manager, so that images retrieved elsewhere (e.g. by applications) can be reused
+        YYImageCache *cache = [YYWebImageManager sharedManager].cache;
+        
+        NSOperationQueue *playerQueue = [[NSOperationQueue alloc] init];
+        playerQueue.name = @"ch.srgssr.letterbox.images.player";
+        playerQueue.maxConcurrentOperationCount = SRGLetterboxImageLoaderPlayerMaxConcurrentOperationCount;
+        playerQueue.qualityOfService = NSQualityOfServiceUserInitiated;
+        
+        NSOperationQueue *cellQueue = [[NSOperationQueue alloc] init];
+        cellQueue.name = @"ch.srgssr.letterbox.images.cells";
+        cellQueue.maxConcurrentOperationCount = SRGLetterboxImageLoaderCellMaxConcurrentOperationCount;
+        cellQueue.qualityOfService = NSQualityOfServiceUtility;
+        
+        SRGLetterboxWebImageManager *(^webImageManager)(NSOperationQueue *, NSOperationQueuePriority, NSQualityOfService) = ^(NSOperationQueue *queue, NSOperationQueuePriority queuePriority, NSQualityOfService qualityOfService) {
+            SRGLetterboxWebImageManager *webImageManager = [[SRGLetterboxWebImageManager alloc] initWithCache:cache queue:queue];
+            webImageManager.queuePriority = queuePriority;
+            webImageManager.qualityOfService = qualityOfService;
+            return webImageManager;
+        };
+        
+        s_webImageManagers = @{ @(SRGLetterboxImagePriorityPoster) : webImageManager(playerQueue, NSOperationQueuePriorityVeryHigh, NSQualityOfServiceUserInitiated),
+                                @(SRGLetterboxImagePriorityUpcoming) : webImageManager(playerQueue, NSOperationQueuePriorityHigh, NSQualityOfServiceUserInitiated),
+                                @(SRGLetterboxImagePriorityVisible) : webImageManager(cellQueue, NSOperationQueuePriorityNormal, NSQualityOfServiceUtility),
+                                @(SRGLetterboxImagePriorityPrefetch) : webImageManager(cellQueue, NSOperationQueuePriorityVeryLow, NSQualityOfServiceBackground) };
+    });
+    
+    YYWebImageManager *webImageManager = s_webImageManagers[@(priority)];
+    NSAssert(webImageManager != nil, @"A manager must be available for each priority");
+    return webImageManager;
+}
+
++ (YYWebImageOperation *)requestImageWithURL:(NSURL *)URL priority:(SRGLetterboxImagePriority)priority completion:(YYWebImageCompletionBlock)completion
+{
+    YYWebImageManager *webImageManager = [self webImageManagerWithPriority:priority];
+    return [webImageManager requestImageWithURL:URL options:0 progress:nil transform:nil completion:completion];
+}
+
+@end
+
+@implementation SRGLetterboxWebImageManager
+
+#pragma mark Overrides
+
+- (YYWebImageOperation *)requestImageWithURL:(NSURL *)url
+                                     options:(YYWebImageOptions)options
+                                    progress:(YYWebImageProgressBlock)progress
+                                   transform:(YYWebImageTransformBlock)transform
+                                  completion:(YYWebImageCompletionBlock)completion
+{
+    // Operations are enqueued by the parent implementation, but only dequeued asynchronously. Setting their priority
+    // right afterwards is therefore enough for them to be scheduled accordingly.
+    YYWebImageOperation *operation = [super requestImageWithURL:url options:options progress:progress transform:transform completion:completion];
+    operation.queuePriority = self.queuePriority;
+    operation.qualityOfService = self.qualityOfService;
+    return operation;
+}
+
+@end
@@ -0,0 +1,61 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+@import SRGDataProvider;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Retrieves media compositions ahead of time and keeps them for a limited amount of time, so that playback of medias
+ *  which will likely be played soon (upcoming media, adjacent channels) does not require any request.
+ *
+ *  @discussion Must be used from the main thread.
+ */
+@interface SRGLetterboxMediaCompositionPreloader : NSObject
+
+/**
+ *  Create a preloader whose media compositions are considered valid during the specified time interval after they
+ *  have been retrieved. Retrieval is attempted again at most once every half interval, failed attempts keeping the
+ *  previous media composition (if any) until it expires.
+ */
+- (instancetype)initWithMaximumAge:(NSTimeInterval)maximumAge;
+
+/**
+ *  Retrieve the media composition for the specified URN and standalone setting with a data provider, unless a request
+ *  is already running or a recent media composition is available.
+ */
+- (void)preloadMediaCompositionForURN:(NSString *)URN standalone:(BOOL)standalone withDataProvider:(SRGDataProvider *)dataProvider;
+
+/**
+ *  The media composition available for the specified URN and standalone setting, `nil` if none or if too old.
+ */
+- (nullable SRGMediaComposition *)mediaCompositionForURN:(NSString *)URN standalone:(BOOL)standalone;
+
+/**
+ *  The date at which the media composition available for the specified URN and standalone setting was retrieved, `nil`
+ *  if none or if too old.
+ */
+- (nullable NSDate *)retrievalDateForURN:(NSString *)URN standalone:(BOOL)standalone;
+
+/**
+ *  Remove media compositions (cancelling pending requests) for all URNs except the specified ones.
+ */
+- (void)removeMediaCompositionsExceptForURNs:(NSSet<NSString *> *)URNs;
+
+/**
+ *  Remove all media compositions, cancelling pending requests.
+ */
+- (void)removeAllMediaCompositions;
+
+@end
+
+@interface SRGLetterboxMediaCompositionPreloader (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,141 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGLetterboxMediaCompositionPreloader.h"
+
+#import "SRGLetterboxLogger.h"
+
+@import libextobjc;
+
+static NSString *SRGLetterboxMediaCompositionPreloaderKey(NSString *URN, BOOL standalone)
+{
+    return [NSString stringWithFormat:@"%@_%@", URN, @(standalone)];
+}
+
+@interface SRGLetterboxPreloadedMediaComposition : NSObject
+
+@property (nonatomic, copy) NSString *URN;
+@property (nonatomic) SRGMediaComposition *mediaComposition;
+@property (nonatomic) NSDate *date;      // Date at which the media composition was retrieved
+@property (nonatomic) NSDate *attemptDate;      // Date of the last retrieval attempt, successful or not
+@property (nonatomic) SRGRequest *request;
+
+@end
+
+@interface SRGLetterboxMediaCompositionPreloader ()
+
+@property (nonatomic) NSTimeInterval maximumAge;
+@property (nonatomic) NSMutableDictionary<NSString *, SRGLetterboxPreloadedMediaComposition *> *preloadedMediaCompositions;
+
+@end
+
+@implementation SRGLetterboxMediaCompositionPreloader
+
+#pragma mark Object lifecycle
+
+- (instancetype)initWithMaximumAge:(NSTimeInterval)maximumAge
+{
+    if (self = [super init]) {
+        self.maximumAge = maximumAge;
+        self.preloadedMediaCompositions = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    [self removeAllMediaCompositions];
+}
+
+#pragma mark Preloading
+
+- (void)preloadMediaCompositionForURN:(NSString *)URN standalone:(BOOL)standalone withDataProvider:(SRGDataProvider *)dataProvider
+{
+    NSString *key = SRGLetterboxMediaCompositionPreloaderKey(URN, standalone);
+    
+    // Also avoid retrying failed requests too often
+    SRGLetterboxPreloadedMediaComposition *preloadedMediaComposition = self.preloadedMediaCompositions[key];
+    if (preloadedMediaComposition.request.running
+            || (preloadedMediaComposition.attemptDate && [NSDate.date timeIntervalSinceDate:preloadedMediaComposition.attemptDate] <= self.maximumAge / 2.)) {
+        return;
+    }
+    
+    if (! preloadedMediaComposition) {
+        preloadedMediaComposition = [[SRGLetterboxPreloadedMediaComposition alloc] init];
+        preloadedMediaComposition.URN = URN;
+        self.preloadedMediaCompositions[key] = preloadedMediaComposition;
+    }
+    
+    SRGLetterboxLogDebug(@"controller", @"Preloading media composition for %@", URN);
+    
+    // Keep the previous media composition (if any) until a new one is available
+    @weakify(preloadedMediaComposition)
+    preloadedMediaComposition.request = [dataProvider mediaCompositionForURN:URN standalone:standalone withCompletionBlock:^(SRGMediaComposition * _Nullable mediaComposition, NSHTTPURLResponse * _Nullable HTTPResponse, NSError * _Nullable error) {
+        @strongify(preloadedMediaComposition)
+        
+        // Failures must not make the previous media composition look fresher than it is
+        if (mediaComposition) {
+            preloadedMediaComposition.mediaComposition = mediaComposition;
+            preloadedMediaComposition.date = NSDate.date;
+        }
+        preloadedMediaComposition.attemptDate = NSDate.date;
+    }];
+    [preloadedMediaComposition.request resume];
+}
+
+- (SRGMediaComposition *)mediaCompositionForURN:(NSString *)URN standalone:(BOOL)standalone
+{
+    SRGLetterboxPreloadedMediaComposition *preloadedMediaComposition = self.preloadedMediaCompositions[SRGLetterboxMediaCompositionPreloaderKey(URN, standalone)];
+    if (! preloadedMediaComposition.mediaComposition || [NSDate.date timeIntervalSinceDate:preloadedMediaComposition.date] > self.maximumAge) {
+        return nil;
+    }
+    
+    return preloadedMediaComposition.mediaComposition;
+}
+
+- (NSDate *)retrievalDateForURN:(NSString *)URN standalone:(BOOL)standalone
+{
+    if (! [self mediaCompositionForURN:URN standalone:standalone]) {
+        return nil;
+    }
+    
+    return self.preloadedMediaCompositions[SRGLetterboxMediaCompositionPreloaderKey(URN, standalone)].date;
+}
+
+#pragma mark Removal
+
+- (void)removeMediaCompositionsExceptForURNs:(NSSet<NSString *> *)URNs
+{
+    NSSet<NSString *> *keys = [self.preloadedMediaCompositions keysOfEntriesPassingTest:^BOOL(NSString * _Nonnull key, SRGLetterboxPreloadedMediaComposition * _Nonnull preloadedMediaComposition, BOOL * _Nonnull stop) {
+        return ! [URNs containsObject:preloadedMediaComposition.URN];
+    }];
+    for (NSString *key in keys) {
+        [self.preloadedMediaCompositions[key].request cancel];
+    }
+    [self.preloadedMediaCompositions removeObjectsForKeys:keys.allObjects];
+}
+
+- (void)removeAllMediaCompositions
+{
+    [self removeMediaCompositionsExceptForURNs:[NSSet set]];
+}
+
+#pragma mark Description
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p; maximumAge = %@; URNs = %@>",
+            self.class,
+            self,
+            @(self.maximumAge),
+            [self.preloadedMediaCompositions.allValues valueForKey:@keypath(SRGLetterboxPreloadedMediaComposition.new, URN)]];
+}
+
+@end
+
+@implementation SRGLetterboxPreloadedMediaComposition
+
+@end
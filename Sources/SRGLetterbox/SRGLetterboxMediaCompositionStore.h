@@ -0,0 +1,66 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+@import SRGDataProvider;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Small least recently used store of media compositions, persisted on disk so that metadata of recently played medias
+ *  is available immediately after the application has been launched again. Stored media compositions might be outdated
+ *  and must only be used for display purposes until fresh ones have been retrieved.
+ *
+ *  @discussion All media compositions are read at once from a single file the first time the store is accessed, and
+ *              written back in the background when changed. Must be used from the main thread.
+ */
+@interface SRGLetterboxMediaCompositionStore : NSObject
+
+/**
+ *  The store shared by all controllers.
+ */
+@property (class, nonatomic, readonly) SRGLetterboxMediaCompositionStore *sharedStore;
+
+/**
+ *  Return the URL of the file in which the current version stores media compositions within the specified directory,
+ *  which is created if needed. Files stored by other versions, whose models might differ, are removed.
+ */
++ (NSURL *)fileURLInDirectoryAtURL:(NSURL *)directoryURL;
+
+/**
+ *  Create a store persisted to the specified file, holding at most `capacity` media compositions not older than
+ *  `maximumAge`.
+ */
+- (instancetype)initWithFileURL:(NSURL *)fileURL capacity:(NSUInteger)capacity maximumAge:(NSTimeInterval)maximumAge;
+
+/**
+ *  The media composition stored for the specified URN and standalone setting, `nil` if none or if too old.
+ */
+- (nullable SRGMediaComposition *)mediaCompositionForURN:(NSString *)URN standalone:(BOOL)standalone;
+
+/**
+ *  Store a media composition for the specified URN and standalone setting.
+ */
+- (void)storeMediaComposition:(SRGMediaComposition *)mediaComposition forURN:(NSString *)URN standalone:(BOOL)standalone;
+
+/**
+ *  Remove all media compositions.
+ */
+- (void)removeAllMediaCompositions;
+
+/**
+ *  Wait until pending changes have been written to disk.
+ */
+- (void)synchronize;
+
+@end
+
+@interface SRGLetterboxMediaCompositionStore (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,232 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGLetterboxMediaCompositionStore.h"
+
+#import "SRGLetterbox.h"
+#import "SRGLetterboxLogger.h"
+
+// Bump when the archive format changes, so that media compositions stored by previous versions are discarded
+static const NSInteger SRGLetterboxMediaCompositionStoreVersion = 1;
+
+static NSString * const SRGLetterboxMediaCompositionStoreKeysKey = @"keys";
+static NSString * const SRGLetterboxMediaCompositionStoreMediaCompositionsKey = @"mediaCompositions";
+static NSString * const SRGLetterboxMediaCompositionStoreDatesKey = @"dates";
+
+static NSString *SRGLetterboxMediaCompositionStoreKey(NSString *URN, BOOL standalone)
+{
+    return [NSString stringWithFormat:@"%@_%@", URN, @(standalone)];
+}
+
+// Media compositions are read from the caches directory and therefore decoded securely. Nested objects are decoded
+// with these classes as well.
+static NSSet<Class> *SRGLetterboxMediaCompositionStoreAllowedClasses(void)
+{
+    static NSSet<Class> *s_classes;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        s_classes = [NSSet setWithObjects:NSArray.class, NSDictionary.class, NSString.class, NSNumber.class, NSDate.class, NSURL.class,
+                     SRGMediaComposition.class, SRGChapter.class, SRGSegment.class, SRGResource.class, SRGSubtitle.class,
+                     SRGSpriteSheet.class, SRGVariant.class, SRGRelatedContent.class, SRGSocialCount.class, SRGChannel.class, SRGShow.class,
+                     SRGEpisode.class, nil];
+    });
+    return s_classes;
+}
+
+static dispatch_queue_t SRGLetterboxMediaCompositionStoreQueue(void)
+{
+    static dispatch_queue_t s_queue;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        s_queue = dispatch_queue_create("ch.srgssr.letterbox.mediaCompositions", DISPATCH_QUEUE_SERIAL_WITH_AUTORELEASE_POOL);
+        dispatch_set_target_queue(s_queue, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0));
+    });
+    return s_queue;
+}
+
+@interface SRGLetterboxMediaCompositionStore ()
+
+@property (nonatomic) NSURL *fileURL;
+@property (nonatomic) NSUInteger capacity;
+@property (nonatomic) NSTimeInterval maximumAge;
+
+// Lazily loaded. Most recently used keys last.
+@property (nonatomic) NSMutableArray<NSString *> *keys;
+@property (nonatomic) NSMutableDictionary<NSString *, SRGMediaComposition *> *mediaCompositions;
+@property (nonatomic) NSMutableDictionary<NSString *, NSDate *> *dates;
+
+@end
+
+@implementation SRGLetterboxMediaCompositionStore
+
+#pragma mark Class methods
+
++ (SRGLetterboxMediaCompositionStore *)sharedStore
+{
+    static SRGLetterboxMediaCompositionStore *s_store;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        NSURL *cachesDirectoryURL = [NSFileManager.defaultManager URLsForDirectory:NSCachesDirectory inDomains:NSUserDomainMask].firstObject;
+        NSURL *directoryURL = [cachesDirectoryURL URLByAppendingPathComponent:@"ch.srgssr.letterbox.mediaCompositions"];
+        s_store = [[SRGLetterboxMediaCompositionStore alloc] initWithFileURL:[self fileURLInDirectoryAtURL:directoryURL]
+                                                                     capacity:20
+                                                                   maximumAge:7. * 24. * 60. * 60.];
+    });
+    return s_store;
+}
+
++ (NSURL *)fileURLInDirectoryAtURL:(NSURL *)directoryURL
+{
+    NSString *fileName = [NSString stringWithFormat:@"v%@-%@", @(SRGLetterboxMediaCompositionStoreVersion), SRGLetterboxMarketingVersion()];
+    
+    // Remove media compositions archived by other versions, whose models might differ
+    NSArray<NSURL *> *fileURLs = [NSFileManager.defaultManager contentsOfDirectoryAtURL:directoryURL includingPropertiesForKeys:nil options:0 error:NULL];
+    for (NSURL *fileURL in fileURLs) {
+        if (! [fileURL.lastPathComponent isEqualToString:fileName]) {
+            [NSFileManager.defaultManager removeItemAtURL:fileURL error:NULL];
+        }
+    }
+    [NSFileManager.defaultManager createDirectoryAtURL:directoryURL withIntermediateDirectories:YES attributes:nil error:NULL];
+    
+    return [directoryURL URLByAppendingPathComponent:fileName];
+}
+
+#pragma mark Object lifecycle
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL capacity:(NSUInteger)capacity maximumAge:(NSTimeInterval)maximumAge
+{
+    if (self = [super init]) {
+        self.fileURL = fileURL;
+        self.capacity = MAX(capacity, 1);
+        self.maximumAge = maximumAge;
+    }
+    return self;
+}
+
+#pragma mark Persistence
+
+- (void)loadIfNeeded
+{
+    if (self.keys) {
+        return;
+    }
+    
+    self.keys = [NSMutableArray array];
+    self.mediaCompositions = [NSMutableDictionary dictionary];
+    self.dates = [NSMutableDictionary dictionary];
+    
+    NSData *data = [NSData dataWithContentsOfURL:self.fileURL options:NSDataReadingMappedIfSafe error:NULL];
+    if (! data) {
+        return;
+    }
+    
+    NSError *error = nil;
+    NSDictionary *archive = [NSKeyedUnarchiver unarchivedObjectOfClasses:SRGLetterboxMediaCompositionStoreAllowedClasses() fromData:data error:&error];
+    if (! [archive isKindOfClass:NSDictionary.class]) {
+        archive = nil;
+    }
+    
+    NSArray<NSString *> *keys = archive[SRGLetterboxMediaCompositionStoreKeysKey];
+    NSDictionary<NSString *, SRGMediaComposition *> *mediaCompositions = archive[SRGLetterboxMediaCompositionStoreMediaCompositionsKey];
+    NSDictionary<NSString *, NSDate *> *dates = archive[SRGLetterboxMediaCompositionStoreDatesKey];
+    if (! [keys isKindOfClass:NSArray.class] || ! [mediaCompositions isKindOfClass:NSDictionary.class] || ! [dates isKindOfClass:NSDictionary.class]) {
+        SRGLetterboxLogWarning(@"controller", @"Stored media compositions could not be read. Reason: %@", error);
+        [NSFileManager.defaultManager removeItemAtURL:self.fileURL error:NULL];
+        return;
+    }
+    
+    for (NSString *key in keys) {
+        SRGMediaComposition *mediaComposition = mediaCompositions[key];
+        NSDate *date = dates[key];
+        if ([mediaComposition isKindOfClass:SRGMediaComposition.class] && [date isKindOfClass:NSDate.class]
+                && [NSDate.date timeIntervalSinceDate:date] <= self.maximumAge) {
+            [self.keys addObject:key];
+            self.mediaCompositions[key] = mediaComposition;
+            self.dates[key] = date;
+        }
+    }
+}
+
+- (void)save
+{
+    NSDictionary *archive = @{ SRGLetterboxMediaCompositionStoreKeysKey : self.keys.copy,
+                               SRGLetterboxMediaCompositionStoreMediaCompositionsKey : self.mediaCompositions.copy,
+                               SRGLetterboxMediaCompositionStoreDatesKey : self.dates.copy };
+    NSURL *fileURL = self.fileURL;
+    
+    // Media compositions are immutable and can safely be archived in the background
+    dispatch_async(SRGLetterboxMediaCompositionStoreQueue(), ^{
+        NSError *error = nil;
+        NSData *data = [NSKeyedArchiver archivedDataWithRootObject:archive requiringSecureCoding:YES error:&error];
+        if (! data || ! [data writeToURL:fileURL options:NSDataWritingAtomic error:&error]) {
+            SRGLetterboxLogWarning(@"controller", @"Media compositions could not be stored. Reason: %@", error);
+        }
+    });
+}
+
+#pragma mark Lookup and storage
+
+- (SRGMediaComposition *)mediaCompositionForURN:(NSString *)URN standalone:(BOOL)standalone
+{
+    [self loadIfNeeded];
+    
+    NSString *key = SRGLetterboxMediaCompositionStoreKey(URN, standalone);
+    NSDate *date = self.dates[key];
+    if (! date || [NSDate.date timeIntervalSinceDate:date] > self.maximumAge) {
+        return nil;
+    }
+    return self.mediaCompositions[key];
+}
+
+- (void)storeMediaComposition:(SRGMediaComposition *)mediaComposition forURN:(NSString *)URN standalone:(BOOL)standalone
+{
+    [self loadIfNeeded];
+    
+    NSString *key = SRGLetterboxMediaCompositionStoreKey(URN, standalone);
+    [self.keys removeObject:key];
+    [self.keys addObject:key];
+    self.mediaCompositions[key] = mediaComposition;
+    self.dates[key] = NSDate.date;
+    
+    while (self.keys.count > self.capacity) {
+        NSString *evictedKey = self.keys.firstObject;
+        [self.mediaCompositions removeObjectForKey:evictedKey];
+        [self.dates removeObjectForKey:evictedKey];
+        [self.keys removeObjectAtIndex:0];
+    }
+    
+    [self save];
+}
+
+- (void)removeAllMediaCompositions
+{
+    [self loadIfNeeded];
+    
+    [self.keys removeAllObjects];
+    [self.mediaCompositions removeAllObjects];
+    [self.dates removeAllObjects];
+    
+    [self save];
+}
+
+- (void)synchronize
+{
+    dispatch_sync(SRGLetterboxMediaCompositionStoreQueue(), ^{});
+}
+
+#pragma mark Description
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p; fileURL = %@; capacity = %@; keys = %@>",
+            self.class,
+            self,
+            self.fileURL,
+            @(self.capacity),
+            self.keys];
+}
+
+@end
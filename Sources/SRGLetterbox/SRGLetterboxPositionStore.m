@@ -0,0 +1,307 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGLetterboxPositionStore.h"
+
+#import "SRGLetterboxLogger.h"
+
+@import UIKit;
+
+// Bump when the log format changes, so that logs written by previous versions are discarded
+static const NSInteger SRGLetterboxPositionStoreVersion = 1;
+
+// Delay during which changes are batched before being appended to the log
+static const NSTimeInterval SRGLetterboxPositionStoreWriteDelay = 2.;
+
+// The log is compacted when larger than this size and more than twice as large as required
+static const NSUInteger SRGLetterboxPositionStoreMinimumCompactionSize = 64 * 1024;
+
+// Log records are made of the URN length (an empty URN meaning all URNs), the URN in UTF-8 and the time in seconds
+// (negative for removals), in native byte order
+static void SRGLetterboxPositionStoreAppendRecord(NSMutableData *data, NSString *URN, Float64 seconds)
+{
+    NSData *URNData = [URN dataUsingEncoding:NSUTF8StringEncoding];
+    if (URNData.length > UINT16_MAX) {
+        return;
+    }
+    
+    uint16_t length = (uint16_t)URNData.length;
+    [data appendBytes:&length length:sizeof(length)];
+    [data appendData:URNData];
+    [data appendBytes:&seconds length:sizeof(seconds)];
+}
+
+static NSUInteger SRGLetterboxPositionStoreRecordSize(NSString *URN)
+{
+    return sizeof(uint16_t) + [URN lengthOfBytesUsingEncoding:NSUTF8StringEncoding] + sizeof(Float64);
+}
+
+@interface SRGLetterboxPositionStore ()
+
+@property (nonatomic) NSURL *fileURL;
+@property (nonatomic) dispatch_queue_t queue;
+
+// Lazily loaded from the log. Must be accessed with the receiver locked.
+@property (nonatomic) NSMutableDictionary<NSString *, NSNumber *> *times;
+@property (nonatomic) NSMutableData *pendingData;
+@property (nonatomic) NSUInteger logSize;
+@property (nonatomic, getter=isWriteScheduled) BOOL writeScheduled;
+
+@end
+
+@implementation SRGLetterboxPositionStore
+
+#pragma mark Class methods
+
++ (SRGLetterboxPositionStore *)sharedStore
+{
+    static SRGLetterboxPositionStore *s_store;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        // Positions are user data and must not be purged by the system
+        NSURL *applicationSupportDirectoryURL = [NSFileManager.defaultManager URLsForDirectory:NSApplicationSupportDirectory inDomains:NSUserDomainMask].firstObject;
+        NSURL *directoryURL = [applicationSupportDirectoryURL URLByAppendingPathComponent:@"ch.srgssr.letterbox.positions"];
+        NSString *fileName = [NSString stringWithFormat:@"v%@", @(SRGLetterboxPositionStoreVersion)];
+        
+        NSArray<NSURL *> *fileURLs = [NSFileManager.defaultManager contentsOfDirectoryAtURL:directoryURL includingPropertiesForKeys:nil options:0 error:NULL];
+        for (NSURL *fileURL in fileURLs) {
+            if (! [fileURL.lastPathComponent isEqualToString:fileName]) {
+                [NSFileManager.defaultManager removeItemAtURL:fileURL error:NULL];
+            }
+        }
+        [NSFileManager.defaultManager createDirectoryAtURL:directoryURL withIntermediateDirectories:YES attributes:nil error:NULL];
+        
+        s_store = [[SRGLetterboxPositionStore alloc] initWithFileURL:[directoryURL URLByAppendingPathComponent:fileName]];
+    });
+    return s_store;
+}
+
+#pragma mark Object lifecycle
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL
+{
+    if (self = [super init]) {
+        self.fileURL = fileURL;
+        self.pendingData = [NSMutableData data];
+        
+        self.queue = dispatch_queue_create("ch.srgssr.letterbox.positions", DISPATCH_QUEUE_SERIAL_WITH_AUTORELEASE_POOL);
+        dispatch_set_target_queue(self.queue, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0));
+        
+        [NSNotificationCenter.defaultCenter addObserver:self
+                                               selector:@selector(applicationDidEnterBackground:)
+                                                   name:UIApplicationDidEnterBackgroundNotification
+                                                 object:nil];
+    }
+    return self;
+}
+
+#pragma mark Log
+
+// Must be called with the receiver locked
+- (void)loadIfNeeded
+{
+    if (self.times) {
+        return;
+    }
+    
+    self.times = [NSMutableDictionary dictionary];
+    
+    NSData *data = [NSData dataWithContentsOfURL:self.fileURL options:NSDataReadingMappedIfSafe error:NULL];
+    const uint8_t *bytes = data.bytes;
+    NSUInteger offset = 0;
+    
+    while (offset + sizeof(uint16_t) <= data.length) {
+        uint16_t length = 0;
+        memcpy(&length, bytes + offset, sizeof(length));
+        
+        // Ignore a record truncated by a crash while writing
+        if (offset + sizeof(uint16_t) + length + sizeof(Float64) > data.length) {
+            SRGLetterboxLogWarning(@"controller", @"Truncated position log record discarded");
+            truncate(self.fileURL.fileSystemRepresentation, (off_t)offset);
+            break;
+        }
+        offset += sizeof(uint16_t);
+        
+        NSString *URN = [[NSString alloc] initWithBytes:bytes + offset length:length encoding:NSUTF8StringEncoding];
+        offset += length;
+        
+        Float64 seconds = 0.;
+        memcpy(&seconds, bytes + offset, sizeof(seconds));
+        offset += sizeof(seconds);
+        
+        if (length == 0) {
+            [self.times removeAllObjects];
+        }
+        else if (! URN) {
+            continue;
+        }
+        else if (seconds < 0.) {
+            [self.times removeObjectForKey:URN];
+        }
+        else {
+            self.times[URN] = @(seconds);
+        }
+    }
+    
+    self.logSize = offset;
+}
+
+- (void)appendRecordForURN:(NSString *)URN seconds:(Float64)seconds
+{
+    @synchronized(self) {
+        [self loadIfNeeded];
+        
+        if (URN.length == 0) {
+            [self.times removeAllObjects];
+        }
+        else if (seconds < 0.) {
+            if (! self.times[URN]) {
+                return;
+            }
+            [self.times removeObjectForKey:URN];
+        }
+        else {
+            self.times[URN] = @(seconds);
+        }
+        
+        SRGLetterboxPositionStoreAppendRecord(self.pendingData, URN ?: @"", seconds);
+        
+        if (! self.writeScheduled) {
+            self.writeScheduled = YES;
+            dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(SRGLetterboxPositionStoreWriteDelay * NSEC_PER_SEC)), self.queue, ^{
+                [self writePendingData];
+            });
+        }
+    }
+}
+
+// Must be called on the store queue
+- (void)writePendingData
+{
+    NSData *pendingData = nil;
+    NSMutableData *compactedData = nil;
+    
+    @synchronized(self) {
+        self.writeScheduled = NO;
+        
+        if (self.pendingData.length == 0) {
+            return;
+        }
+        
+        pendingData = self.pendingData.copy;
+        self.pendingData.length = 0;
+        self.logSize += pendingData.length;
+        
+        if (self.logSize > SRGLetterboxPositionStoreMinimumCompactionSize) {
+            __block NSUInteger requiredSize = 0;
+            [self.times enumerateKeysAndObjectsUsingBlock:^(NSString * _Nonnull URN, NSNumber * _Nonnull seconds, BOOL * _Nonnull stop) {
+                requiredSize += SRGLetterboxPositionStoreRecordSize(URN);
+            }];
+            
+            if (self.logSize > 2 * requiredSize) {
+                compactedData = [NSMutableData dataWithCapacity:requiredSize];
+                [self.times enumerateKeysAndObjectsUsingBlock:^(NSString * _Nonnull URN, NSNumber * _Nonnull seconds, BOOL * _Nonnull stop) {
+                    SRGLetterboxPositionStoreAppendRecord(compactedData, URN, seconds.doubleValue);
+                }];
+                self.logSize = compactedData.length;
+            }
+        }
+    }
+    
+    if (compactedData) {
+        SRGLetterboxLogDebug(@"controller", @"Compacting position log to %@ bytes", @(compactedData.length));
+        
+        NSError *error = nil;
+        if (! [compactedData writeToURL:self.fileURL options:NSDataWritingAtomic error:&error]) {
+            SRGLetterboxLogWarning(@"controller", @"Position log could not be compacted. Reason: %@", error);
+        }
+        return;
+    }
+    
+    FILE *file = fopen(self.fileURL.fileSystemRepresentation, "ab");
+    if (! file) {
+        SRGLetterboxLogWarning(@"controller", @"Position log could not be opened. Reason: %s", strerror(errno));
+        return;
+    }
+    
+    fwrite(pendingData.bytes, 1, pendingData.length, file);
+    fclose(file);
+}
+
+#pragma mark Positions
+
+- (SRGPosition *)positionForURN:(NSString *)URN
+{
+    @synchronized(self) {
+        [self loadIfNeeded];
+        
+        NSNumber *seconds = self.times[URN];
+        return seconds ? [SRGPosition positionAtTime:CMTimeMakeWithSeconds(seconds.doubleValue, NSEC_PER_SEC)] : nil;
+    }
+}
+
+- (void)saveTime:(CMTime)time forURN:(NSString *)URN
+{
+    if (URN.length == 0 || ! CMTIME_IS_NUMERIC(time)) {
+        return;
+    }
+    
+    [self appendRecordForURN:URN seconds:fmax(CMTimeGetSeconds(time), 0.)];
+}
+
+- (void)removePositionForURN:(NSString *)URN
+{
+    if (URN.length == 0) {
+        return;
+    }
+    
+    [self appendRecordForURN:URN seconds:-1.];
+}
+
+- (void)removeAllPositions
+{
+    [self appendRecordForURN:nil seconds:-1.];
+}
+
+- (void)synchronize
+{
+    dispatch_sync(self.queue, ^{
+        [self writePendingData];
+    });
+}
+
+#pragma mark Notifications
+
+- (void)applicationDidEnterBackground:(NSNotification *)notification
+{
+    // Ensure the application is not suspended before the last positions have been written
+    UIApplication *application = UIApplication.sharedApplication;
+    __block UIBackgroundTaskIdentifier backgroundTaskIdentifier = UIBackgroundTaskInvalid;
+    void (^endBackgroundTask)(void) = ^{
+        if (backgroundTaskIdentifier != UIBackgroundTaskInvalid) {
+            [application endBackgroundTask:backgroundTaskIdentifier];
+            backgroundTaskIdentifier = UIBackgroundTaskInvalid;
+        }
+    };
+    backgroundTaskIdentifier = [application beginBackgroundTaskWithName:@"ch.srgssr.letterbox.positions" expirationHandler:endBackgroundTask];
+    
+    dispatch_async(self.queue, ^{
+        [self writePendingData];
+        dispatch_async(dispatch_get_main_queue(), endBackgroundTask);
+    });
+}
+
+#pragma mark Description
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p; fileURL = %@>",
+            self.class,
+            self,
+            self.fileURL];
+}
+
+@end
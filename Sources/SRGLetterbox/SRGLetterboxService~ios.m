@@ -11,6 +11,8 @@
 #import "SRGLetterboxService.h"
 
 #import "MPRemoteCommand+SRGLetterbox.h"
+#import "NSTimer+SRGLetterbox.h"
+#import "SRGLetterboxArtworkCache.h"
 #import "SRGLetterboxController+Private.h"
 #import "SRGLetterboxLogger.h"
 #import "SRGLetterboxMetadata.h"
@@ -23,10 +25,15 @@
 @import MediaPlayer;
 @import SRGAppearance;
 @import SRGMediaPlayer;
-@import YYWebImage;
 
 NSString * const SRGLetterboxServiceSettingsDidChangeNotification = @"SRGLetterboxServiceSettingsDidChangeNotification";
 
+// Minimum interval between two now playing information pushes to the system (each of them being an XPC round trip)
+static const NSTimeInterval SRGLetterboxServiceNowPlayingInfoMinimumUpdateInterval = 0.5;
+
+// Number of artwork images kept (current, next and previous medias, as well as a few recently played ones)
+static const NSUInteger SRGLetterboxServiceArtworkCacheCapacity = 5;
+
 static MPNowPlayingInfoLanguageOptionGroup *SRGLetterboxServiceLanguageOptionGroup(NSArray<AVMediaSelectionOption *> *selectionOption, BOOL allowEmptySelection);
 
 @interface SRGLetterboxService () <AVPictureInPictureControllerDelegate> {
@@ -44,11 +51,20 @@ static MPNowPlayingInfoLanguageOptionGroup *SRGLetterboxServiceLanguageOptionGro
 @property (nonatomic) SRGLetterboxCommands allowedCommands;
 
 @property (nonatomic, weak) id periodicTimeObserver;
-@property (nonatomic) YYWebImageOperation *imageOperation;
 
-@property (atomic) NSURL *cachedArtworkURL;
-@property (atomic) UIImage *cachedArtworkImage;
-@property (atomic) NSError *cachedArtworkError;
+// Now playing information parts which do not change during playback (media information, artwork, available languages)
+@property (nonatomic) NSDictionary<NSString *, id> *nowPlayingStaticInfo;
+@property (nonatomic, weak) AVAsset *nowPlayingLanguageOptionsAsset;
+@property (nonatomic) NSArray<MPNowPlayingInfoLanguageOptionGroup *> *nowPlayingLanguageOptionGroups;
+@property (nonatomic) NSArray<MPNowPlayingInfoLanguageOption *> *nowPlayingCurrentLanguageOptions;
+
+// Last information pushed to the system, and timer for coalesced pushes
+@property (nonatomic) NSDictionary<NSString *, id> *nowPlayingInfo;
+@property (nonatomic) NSDate *nowPlayingInfoUpdateDate;
+@property (nonatomic) NSTimer *nowPlayingInfoUpdateTimer;
+
+@property (nonatomic) SRGLetterboxArtworkCache *artworkCache;
+@property (nonatomic) UIImage *displayedArtworkImage;      // Kept during artwork retrieval for smoother transitions
 
 @end
 
@@ -76,6 +92,7 @@ static MPNowPlayingInfoLanguageOptionGroup *SRGLetterboxServiceLanguageOptionGro
     if (self = [super init]) {
         self.nowPlayingInfoAndCommandsEnabled = YES;
         self.allowedCommands = SRGLetterboxCommandsDefault;
+        self.artworkCache = [[SRGLetterboxArtworkCache alloc] initWithCapacity:SRGLetterboxServiceArtworkCacheCapacity];
         
         [NSNotificationCenter.defaultCenter addObserver:self
                                                selector:@selector(applicationDidEnterBackground:)
@@ -105,6 +122,7 @@ static MPNowPlayingInfoLanguageOptionGroup *SRGLetterboxServiceLanguageOptionGro
 - (void)dealloc
 {
     self.controller = nil;
+    self.nowPlayingInfoUpdateTimer = nil;
 }
 
 #pragma mark Getters and setters
@@ -160,6 +178,8 @@ static MPNowPlayingInfoLanguageOptionGroup *SRGLetterboxServiceLanguageOptionGro
     
     _controller = controller;
     
+    self.nowPlayingInfoUpdateTimer = nil;
+    [self invalidateNowPlayingStaticInformation];
     [self updateMetadataWithController:controller];
     
     if (controller) {
@@ -238,6 +258,12 @@ static MPNowPlayingInfoLanguageOptionGroup *SRGLetterboxServiceLanguageOptionGro
     [NSNotificationCenter.defaultCenter postNotificationName:SRGLetterboxServiceSettingsDidChangeNotification object:self];
 }
 
+- (void)setNowPlayingInfoUpdateTimer:(NSTimer *)nowPlayingInfoUpdateTimer
+{
+    [_nowPlayingInfoUpdateTimer invalidate];
+    _nowPlayingInfoUpdateTimer = nowPlayingInfoUpdateTimer;
+}
+
 #pragma mark Enabling and disabling the service
 
 - (void)enableWithController:(SRGLetterboxController *)controller pictureInPictureDelegate:(id<SRGLetterboxPictureInPictureDelegate>)pictureInPictureDelegate
@@ -351,7 +377,7 @@ static MPNowPlayingInfoLanguageOptionGroup *SRGLetterboxServiceLanguageOptionGro
     MPRemoteCommand *changePlaybackPositionCommand = commandCenter.changePlaybackPositionCommand;
     changePlaybackPositionCommand.enabled = NO;
     [changePlaybackPositionCommand srg_addUniqueTarget:self action:@selector(changePlaybackPosition:)];
-
+    
     MPRemoteCommand *enableLanguageOptionCommand = commandCenter.enableLanguageOptionCommand;
     enableLanguageOptionCommand.enabled = NO;
     [enableLanguageOptionCommand srg_addUniqueTarget:self action:@selector(enableLanguageOption:)];
@@ -395,7 +421,7 @@ static MPNowPlayingInfoLanguageOptionGroup *SRGLetterboxServiceLanguageOptionGro
     
     MPRemoteCommand *nextTrackCommand = commandCenter.nextTrackCommand;
     [nextTrackCommand removeTarget:self action:@selector(nextTrack:)];
-
+    
     MPRemoteCommand *changePlaybackPositionCommand = commandCenter.changePlaybackPositionCommand;
     [changePlaybackPositionCommand removeTarget:self action:@selector(changePlaybackPosition:)];
     
@@ -453,21 +479,96 @@ static MPNowPlayingInfoLanguageOptionGroup *SRGLetterboxServiceLanguageOptionGro
     }
 }
 
+// Request a now playing information update. Updates are coalesced so that the system is not flooded with changes
+// (e.g. while scrubbing), with the most recent information always pushed in the end.
 - (void)updateNowPlayingInformationWithController:(SRGLetterboxController *)controller
 {
     if (! self.nowPlayingInfoAndCommandsEnabled) {
         return;
     }
     
+    if (! controller.displayableMedia) {
+        self.nowPlayingInfoUpdateTimer = nil;
+        [self pushNowPlayingInformationWithController:controller];
+        return;
+    }
+    
+    if (self.nowPlayingInfoUpdateTimer) {
+        return;
+    }
+    
+    NSTimeInterval elapsedTimeInterval = self.nowPlayingInfoUpdateDate ? -[self.nowPlayingInfoUpdateDate timeIntervalSinceNow] : DBL_MAX;
+    if (elapsedTimeInterval >= SRGLetterboxServiceNowPlayingInfoMinimumUpdateInterval) {
+        [self pushNowPlayingInformationWithController:controller];
+    }
+    else {
+        @weakify(self)
+        self.nowPlayingInfoUpdateTimer = [NSTimer srgletterbox_timerWithTimeInterval:SRGLetterboxServiceNowPlayingInfoMinimumUpdateInterval - elapsedTimeInterval repeats:NO block:^(NSTimer * _Nonnull timer) {
+            @strongify(self)
+            self.nowPlayingInfoUpdateTimer = nil;
+            [self pushNowPlayingInformationWithController:self.controller];
+        }];
+    }
+}
+
+- (void)pushNowPlayingInformationWithController:(SRGLetterboxController *)controller
+{
+    if (! self.nowPlayingInfoAndCommandsEnabled) {
+        return;
+    }
+    
     SRGLetterboxLogDebug(@"service", @"Now playing info metadata update started");
     
     SRGMedia *media = controller.displayableMedia;
     if (! media) {
-        [self clearArtworkImageCache];
-        MPNowPlayingInfoCenter.defaultCenter.nowPlayingInfo = nil;
+        self.displayedArtworkImage = nil;
+        [self invalidateNowPlayingStaticInformation];
+        [self setNowPlayingInfo:nil];
         return;
     }
     
+    NSMutableDictionary *nowPlayingInfo = [self nowPlayingStaticInformationWithController:controller].mutableCopy;
+    
+    SRGMediaPlayerController *mediaPlayerController = controller.mediaPlayerController;
+    
+    CMTimeRange timeRange = mediaPlayerController.timeRange;
+    CMTime time = CMTIME_IS_INDEFINITE(mediaPlayerController.seekTargetTime) ? mediaPlayerController.currentTime : mediaPlayerController.seekTargetTime;
+    nowPlayingInfo[MPNowPlayingInfoPropertyElapsedPlaybackTime] = @(CMTimeGetSeconds(CMTimeSubtract(time, timeRange.start)));
+    nowPlayingInfo[MPMediaItemPropertyPlaybackDuration] = @(CMTimeGetSeconds(timeRange.duration));
+    nowPlayingInfo[MPNowPlayingInfoPropertyPlaybackRate] = @(mediaPlayerController.effectivePlaybackRate);
+    nowPlayingInfo[MPNowPlayingInfoPropertyDefaultPlaybackRate] = @(mediaPlayerController.playbackRate);
+    
+    BOOL isLivestream = (mediaPlayerController.streamType == SRGMediaPlayerStreamTypeLive);
+    nowPlayingInfo[MPNowPlayingInfoPropertyIsLiveStream] = @(isLivestream);
+    
+    [self updateNowPlayingLanguageOptionsWithController:controller];
+    nowPlayingInfo[MPNowPlayingInfoPropertyAvailableLanguageOptions] = self.nowPlayingLanguageOptionGroups;
+    nowPlayingInfo[MPNowPlayingInfoPropertyCurrentLanguageOptions] = self.nowPlayingCurrentLanguageOptions;
+    
+    [self setNowPlayingInfo:nowPlayingInfo.copy];
+}
+
+// Push information to the system, only if something changed
+- (void)setNowPlayingInfo:(NSDictionary<NSString *, id> *)nowPlayingInfo
+{
+    if (_nowPlayingInfo == nowPlayingInfo || [_nowPlayingInfo isEqualToDictionary:nowPlayingInfo]) {
+        return;
+    }
+    
+    _nowPlayingInfo = nowPlayingInfo;
+    
+    self.nowPlayingInfoUpdateDate = NSDate.date;
+    MPNowPlayingInfoCenter.defaultCenter.nowPlayingInfo = nowPlayingInfo;
+}
+
+// Information which only needs to be calculated once per media (and artwork)
+- (NSDictionary<NSString *, id> *)nowPlayingStaticInformationWithController:(SRGLetterboxController *)controller
+{
+    if (self.nowPlayingStaticInfo) {
+        return self.nowPlayingStaticInfo;
+    }
+    
+    SRGMedia *media = controller.displayableMedia;
     NSMutableDictionary *nowPlayingInfo = [NSMutableDictionary dictionary];
     
     switch (media.mediaType) {
@@ -475,12 +576,12 @@ static MPNowPlayingInfoLanguageOptionGroup *SRGLetterboxServiceLanguageOptionGro
             nowPlayingInfo[MPMediaItemPropertyMediaType] = @(MPMediaTypeAnyAudio);
             break;
         }
-            
+        
         case SRGMediaTypeVideo: {
             nowPlayingInfo[MPMediaItemPropertyMediaType] = @(MPMediaTypeAnyVideo);
             break;
         }
-            
+        
         default: {
             nowPlayingInfo[MPMediaItemPropertyMediaType] = @(MPMediaTypeAny);
             break;
@@ -493,70 +594,96 @@ static MPNowPlayingInfoLanguageOptionGroup *SRGLetterboxServiceLanguageOptionGro
     
     static const SRGImageSize kSize = SRGImageSizeMedium;
     
-    // A subtle issue might arise if the controller is strongly captured by the block (successive now playing information
-    // center updates might deadlock).
-    @weakify(self) @weakify(controller)
-    UIImage *artworkImage = [self cachedArtworkImageForController:controller withSize:kSize completion:^{
-        @strongify(self) @strongify(controller)
-        [self updateNowPlayingInformationWithController:controller];
-    }];
+    UIImage *artworkImage = [self artworkImageForController:controller withSize:kSize];
     if (artworkImage) {
-        nowPlayingInfo[MPMediaItemPropertyArtwork] = [[MPMediaItemArtwork alloc] initWithBoundsSize:SRGRecommendedImageCGSize(kSize, SRGImageVariantDefault) requestHandler:^UIImage * _Nonnull(CGSize size) {
-            // Return the closest image we have, see https://developer.apple.com/videos/play/wwdc2017/251. Here just
-            // the image we retrieved for this specific purpose.
-            return artworkImage;
+        // A subtle issue might arise if the controller is strongly captured by the block (successive now playing information
+        // center updates might deadlock).
+        NSString *URN = media.URN;
+        NSURL *artworkURL = SRGLetterboxImageURL(media.image, kSize, controller);
+        SRGLetterboxArtworkCache *artworkCache = self.artworkCache;
+        nowPlayingInfo[MPMediaItemPropertyArtwork] = [[MPMediaItemArtwork alloc] initWithBoundsSize:artworkImage.size requestHandler:^UIImage * _Nonnull(CGSize size) {
+            // Return the closest image we have, see https://developer.apple.com/videos/play/wwdc2017/251. Images are
+            // rendered once per requested size, and only when the artwork is available (otherwise the placeholder or
+            // the previously displayed image is returned).
+            UIImage *image = artworkURL ? [artworkCache imageForURN:URN URL:artworkURL withSize:size] : nil;
+            return image ?: artworkImage;
         }];
     }
-    else {
-        nowPlayingInfo[MPMediaItemPropertyArtwork] = nil;
+    
+    // Prefetch artwork for medias which are likely to be played next
+    [self prefetchArtworkForMedia:controller.nextMedia controller:controller withSize:kSize];
+    [self prefetchArtworkForMedia:controller.previousMedia controller:controller withSize:kSize];
+    
+    self.nowPlayingStaticInfo = nowPlayingInfo.copy;
+    return self.nowPlayingStaticInfo;
+}
+
+// Audio tracks and subtitles. Available options are calculated once per asset, current options only when invalidated
+- (void)updateNowPlayingLanguageOptionsWithController:(SRGLetterboxController *)controller
+{
+    AVPlayerItem *playerItem = controller.mediaPlayerController.player.currentItem;
+    AVAsset *asset = playerItem.asset;
+    
+    if (asset != self.nowPlayingLanguageOptionsAsset) {
+        self.nowPlayingLanguageOptionsAsset = nil;
+        self.nowPlayingLanguageOptionGroups = nil;
+        self.nowPlayingCurrentLanguageOptions = nil;
     }
     
-    SRGMediaPlayerController *mediaPlayerController = controller.mediaPlayerController;
+    if (self.nowPlayingLanguageOptionGroups && self.nowPlayingCurrentLanguageOptions) {
+        return;
+    }
     
-    CMTimeRange timeRange = mediaPlayerController.timeRange;
-    CMTime time = CMTIME_IS_INDEFINITE(mediaPlayerController.seekTargetTime) ? mediaPlayerController.currentTime : mediaPlayerController.seekTargetTime;
-    nowPlayingInfo[MPNowPlayingInfoPropertyElapsedPlaybackTime] = @(CMTimeGetSeconds(CMTimeSubtract(time, timeRange.start)));
-    nowPlayingInfo[MPMediaItemPropertyPlaybackDuration] = @(CMTimeGetSeconds(timeRange.duration));
-    nowPlayingInfo[MPNowPlayingInfoPropertyPlaybackRate] = @(mediaPlayerController.effectivePlaybackRate);
-    nowPlayingInfo[MPNowPlayingInfoPropertyDefaultPlaybackRate] = @(mediaPlayerController.playbackRate);
+    if ([asset statusOfValueForKey:@keypath(asset.availableMediaCharacteristicsWithMediaSelectionOptions) error:NULL] != AVKeyValueStatusLoaded) {
+        self.nowPlayingLanguageOptionGroups = @[];
+        self.nowPlayingCurrentLanguageOptions = @[];
+        return;
+    }
     
-    BOOL isLivestream = (mediaPlayerController.streamType == SRGMediaPlayerStreamTypeLive);
-    nowPlayingInfo[MPNowPlayingInfoPropertyIsLiveStream] = @(isLivestream);
+    AVMediaSelectionGroup *audioGroup = [asset mediaSelectionGroupForMediaCharacteristic:AVMediaCharacteristicAudible];
+    NSArray<AVMediaSelectionOption *> *audioOptions = audioGroup.options;
     
-    // Audio tracks and subtitles
-    NSMutableArray<MPNowPlayingInfoLanguageOptionGroup *> *languageOptionGroups = [NSMutableArray array];
-    NSMutableArray<MPNowPlayingInfoLanguageOption *> *currentLanguageOptions = [NSMutableArray array];
+    AVMediaSelectionGroup *subtitleGroup = [asset mediaSelectionGroupForMediaCharacteristic:AVMediaCharacteristicLegible];
+    NSArray<AVMediaSelectionOption *> *subtitleOptions = [AVMediaSelectionGroup mediaSelectionOptionsFromArray:subtitleGroup.options withoutMediaCharacteristics:@[AVMediaCharacteristicContainsOnlyForcedSubtitles]];
     
-    AVPlayerItem *playerItem = mediaPlayerController.player.currentItem;
-    AVAsset *asset = playerItem.asset;
-    if ([asset statusOfValueForKey:@keypath(asset.availableMediaCharacteristicsWithMediaSelectionOptions) error:NULL] == AVKeyValueStatusLoaded) {
-        AVMediaSelectionGroup *audioGroup = [asset mediaSelectionGroupForMediaCharacteristic:AVMediaCharacteristicAudible];
-        NSArray<AVMediaSelectionOption *> *audioOptions = audioGroup.options;
+    if (! self.nowPlayingLanguageOptionGroups) {
+        NSMutableArray<MPNowPlayingInfoLanguageOptionGroup *> *languageOptionGroups = [NSMutableArray array];
         if (audioOptions.count > 1) {
             [languageOptionGroups addObject:SRGLetterboxServiceLanguageOptionGroup(audioOptions, NO)];
-            
-            AVMediaSelectionOption *selectedAudibleOption = [playerItem.currentMediaSelection selectedMediaOptionInMediaSelectionGroup:audioGroup];
-            if (selectedAudibleOption) {
-                [currentLanguageOptions addObject:[selectedAudibleOption makeNowPlayingInfoLanguageOption]];
-            }
         }
-        
-        AVMediaSelectionGroup *subtitleGroup = [asset mediaSelectionGroupForMediaCharacteristic:AVMediaCharacteristicLegible];
-        NSArray<AVMediaSelectionOption *> *subtitleOptions = [AVMediaSelectionGroup mediaSelectionOptionsFromArray:subtitleGroup.options withoutMediaCharacteristics:@[AVMediaCharacteristicContainsOnlyForcedSubtitles]];
         if (subtitleOptions.count > 0) {
             [languageOptionGroups addObject:SRGLetterboxServiceLanguageOptionGroup(subtitleOptions, YES)];
         }
-        
-        AVMediaSelectionOption *selectedLegibleOption = [playerItem.currentMediaSelection selectedMediaOptionInMediaSelectionGroup:subtitleGroup];
-        if (selectedLegibleOption) {
-            [currentLanguageOptions addObject:[selectedLegibleOption makeNowPlayingInfoLanguageOption]];
-        }
+        self.nowPlayingLanguageOptionGroups = languageOptionGroups.copy;
     }
     
-    nowPlayingInfo[MPNowPlayingInfoPropertyAvailableLanguageOptions] = languageOptionGroups.copy;
-    nowPlayingInfo[MPNowPlayingInfoPropertyCurrentLanguageOptions] = currentLanguageOptions.copy;
+    NSMutableArray<MPNowPlayingInfoLanguageOption *> *currentLanguageOptions = [NSMutableArray array];
+    if (audioOptions.count > 1) {
+        AVMediaSelectionOption *selectedAudibleOption = [playerItem.currentMediaSelection selectedMediaOptionInMediaSelectionGroup:audioGroup];
+        if (selectedAudibleOption) {
+            [currentLanguageOptions addObject:[selectedAudibleOption makeNowPlayingInfoLanguageOption]];
+        }
+    }
     
-    MPNowPlayingInfoCenter.defaultCenter.nowPlayingInfo = nowPlayingInfo.copy;
+    AVMediaSelectionOption *selectedLegibleOption = [playerItem.currentMediaSelection selectedMediaOptionInMediaSelectionGroup:subtitleGroup];
+    if (selectedLegibleOption) {
+        [currentLanguageOptions addObject:[selectedLegibleOption makeNowPlayingInfoLanguageOption]];
+    }
+    self.nowPlayingCurrentLanguageOptions = currentLanguageOptions.copy;
+    self.nowPlayingLanguageOptionsAsset = asset;
+}
+
+- (void)invalidateNowPlayingStaticInformation
+{
+    self.nowPlayingStaticInfo = nil;
+    self.nowPlayingLanguageOptionsAsset = nil;
+    self.nowPlayingLanguageOptionGroups = nil;
+    self.nowPlayingCurrentLanguageOptions = nil;
+}
+
+- (void)invalidateNowPlayingCurrentLanguageOptions
+{
+    self.nowPlayingCurrentLanguageOptions = nil;
 }
 
 - (void)updateMetadataWithController:(SRGLetterboxController *)controller
@@ -571,73 +698,99 @@ static MPNowPlayingInfoLanguageOptionGroup *SRGLetterboxServiceLanguageOptionGro
     }
     else if (self.nowPlayingInfoAndCommandsInstalled) {
         [self resetRemoteCommandCenter];
-        MPNowPlayingInfoCenter.defaultCenter.nowPlayingInfo = nil;
+        self.nowPlayingInfoUpdateTimer = nil;
+        [self invalidateNowPlayingStaticInformation];
+        [self setNowPlayingInfo:nil];
         self.nowPlayingInfoAndCommandsInstalled = NO;
     }
 }
 
-- (NSURL *)artworkURLForController:(SRGLetterboxController *)controller withSize:(SRGImageSize)size
+// Return the placeholder if readily available, otherwise rasterise it in the background and update now playing information
+// when done
+- (UIImage *)placeholderImageWithSize:(SRGImageSize)size
 {
-    SRGMedia *media = controller.displayableMedia;
-    NSURL *artworkURL = SRGLetterboxImageURL(media.image, size, controller);
-    if (! artworkURL) {
-        artworkURL = [UIImage srg_URLForVectorImageAtPath:SRGLetterboxFilePathForImagePlaceholder() withSize:SRGRecommendedImageCGSize(size, SRGImageVariantDefault)];
+    CGFloat width = SRGRecommendedImageCGSize(size, SRGImageVariantDefault).width;
+    UIImage *placeholderImage = [UIImage srg_letterboxCachedVectorImageAtPath:SRGLetterboxFilePathForImagePlaceholder() withWidth:width tintColor:nil];
+    if (placeholderImage) {
+        return placeholderImage;
     }
     
-    NSAssert(artworkURL != nil, @"An artwork URL must always be returned");
-    return artworkURL;
+    @weakify(self)
+    [UIImage srg_letterboxRequestVectorImageAtPath:SRGLetterboxFilePathForImagePlaceholder() withWidth:width tintColor:nil completion:^(UIImage * _Nullable image) {
+        @strongify(self)
+        
+        if (image && self.controller) {
+            [self invalidateNowPlayingStaticInformation];
+            [self updateNowPlayingInformationWithController:self.controller];
+        }
+    }];
+    return nil;
 }
 
-// Return the best available image to display in the control center, performing an asynchronous update only when an image is not
-// readily available from the cache
-- (UIImage *)cachedArtworkImageForController:(SRGLetterboxController *)controller withSize:(SRGImageSize)size completion:(void (^)(void))completion
+// Return the best available image to display in the control center, performing an asynchronous update if the image is not
+// readily available from the cache. Now playing information is updated when the image has been retrieved.
+- (UIImage *)artworkImageForController:(SRGLetterboxController *)controller withSize:(SRGImageSize)size
 {
-    NSURL *artworkURL = [self artworkURLForController:controller withSize:size];
-    if (! [artworkURL isEqual:self.cachedArtworkURL] || ! self.cachedArtworkImage) {
-        // SRGLetterboxImageURL might return file URLs for overridden images
-        if (artworkURL.fileURL) {
-            UIImage *image = [UIImage imageWithContentsOfFile:artworkURL.path];
-            self.cachedArtworkURL = artworkURL;
-            self.cachedArtworkImage = image;
-            self.cachedArtworkError = nil;
-            return image;
+    SRGMedia *media = controller.displayableMedia;
+    NSString *URN = media.URN;
+    NSURL *artworkURL = SRGLetterboxImageURL(media.image, size, controller);
+    if (! artworkURL) {
+        UIImage *placeholderImage = [self placeholderImageWithSize:size];
+        self.displayedArtworkImage = placeholderImage;
+        return placeholderImage;
+    }
+    
+    // The completion block is called synchronously if the image is readily available (or could not be retrieved)
+    __block BOOL synchronous = YES;
+    __block BOOL available = NO;
+    __block UIImage *artworkImage = nil;
+    
+    @weakify(self)
+    [self.artworkCache requestImageForURN:URN URL:artworkURL priority:SRGLetterboxImagePriorityPoster withCompletionBlock:^(UIImage * _Nullable image, NSError * _Nullable error) {
+        @strongify(self)
+        
+        if (synchronous) {
+            available = YES;
+            artworkImage = image;
         }
-        else {
-            NSURL *placeholderImageURL = [UIImage srg_URLForVectorImageAtPath:SRGLetterboxFilePathForImagePlaceholder() withSize:SRGRecommendedImageCGSize(size, SRGImageVariantDefault)];
-            UIImage *placeholderImage = [UIImage imageWithContentsOfFile:placeholderImageURL.path];
-            
-            SRGLetterboxLogDebug(@"service", @"Artwork image update triggered");
-            
-            // Request the image when not available. Calling -cachedArtworkImageForController:withSize: once the completion handler is called
-            // will then return the image immediately
-            @weakify(self)
-            self.imageOperation = [[YYWebImageManager sharedManager] requestImageWithURL:artworkURL options:0 progress:nil transform:nil completion:^(UIImage * _Nullable image, NSURL * _Nonnull url, YYWebImageFromType from, YYWebImageStage stage, NSError * _Nullable error) {
-                @strongify(self)
-                
-                dispatch_async(dispatch_get_main_queue(), ^{
-                    self.cachedArtworkURL = artworkURL;
-                    self.cachedArtworkImage = image ?: placeholderImage;
-                    self.cachedArtworkError = error;
-                    
-                    completion ? completion() : nil;
-                });
-            }];
-            
-            // Keep the current artwork during retrieval (even if it does not match) for smoother transitions, or use
-            // the placeholder when none
-            return self.cachedArtworkImage ?: placeholderImage;
+        else if ([self.controller.displayableMedia.URN isEqualToString:URN]) {
+            [self invalidateNowPlayingStaticInformation];
+            [self updateNowPlayingInformationWithController:self.controller];
         }
+    }];
+    synchronous = NO;
+    
+    if (available) {
+        // Use the placeholder if the image could not be retrieved
+        UIImage *image = artworkImage ?: [self placeholderImageWithSize:size];
+        self.displayedArtworkImage = image;
+        return image;
     }
     else {
-        return self.cachedArtworkImage;
+        SRGLetterboxLogDebug(@"service", @"Artwork image update triggered");
+        
+        // Keep the current artwork during retrieval (even if it does not match) for smoother transitions. Use the placeholder
+        // when none
+        return self.displayedArtworkImage ?: [self placeholderImageWithSize:size];
     }
 }
 
-- (void)clearArtworkImageCache
+- (void)prefetchArtworkForMedia:(SRGMedia *)media controller:(SRGLetterboxController *)controller withSize:(SRGImageSize)size
 {
-    self.cachedArtworkURL = nil;
-    self.cachedArtworkImage = nil;
-    self.cachedArtworkError = nil;
+    if (! media) {
+        return;
+    }
+    
+    NSURL *artworkURL = SRGLetterboxImageURL(media.image, size, controller);
+    if (artworkURL) {
+        [self.artworkCache requestImageForURN:media.URN URL:artworkURL priority:SRGLetterboxImagePriorityPrefetch withCompletionBlock:nil];
+    }
+    else {
+        [UIImage srg_letterboxRequestVectorImageAtPath:SRGLetterboxFilePathForImagePlaceholder()
+                                             withWidth:SRGRecommendedImageCGSize(size, SRGImageVariantDefault).width
+                                             tintColor:nil
+                                            completion:nil];
+    }
 }
 
 #pragma mark Remote commands
@@ -860,6 +1013,7 @@ static MPNowPlayingInfoLanguageOptionGroup *SRGLetterboxServiceLanguageOptionGro
 
 - (void)metadataDidChange:(NSNotification *)notification
 {
+    [self invalidateNowPlayingStaticInformation];
     [self updateNowPlayingInformationWithController:self.controller];
 }
 
@@ -875,11 +1029,13 @@ static MPNowPlayingInfoLanguageOptionGroup *SRGLetterboxServiceLanguageOptionGro
 
 - (void)audioTrackDidChange:(NSNotification *)notification
 {
+    [self invalidateNowPlayingCurrentLanguageOptions];
     [self updateNowPlayingInformationWithController:self.controller];
 }
 
 - (void)subtitleTrackDidChange:(NSNotification *)notification
 {
+    [self invalidateNowPlayingCurrentLanguageOptions];
     [self updateNowPlayingInformationWithController:self.controller];
 }
 
@@ -910,15 +1066,19 @@ static MPNowPlayingInfoLanguageOptionGroup *SRGLetterboxServiceLanguageOptionGro
 
 - (void)rechabilityDidChange:(NSNotification *)notification
 {
-    if ([FXReachability sharedInstance].reachable) {
-        if (self.cachedArtworkError) {
-            self.cachedArtworkImage = nil;
-            self.cachedArtworkURL = nil;
-            self.cachedArtworkError = nil;
-            
+    if (! [FXReachability sharedInstance].reachable) {
+        return;
+    }
+    
+    // Retrieve failed artwork again within the controller initial reconnection delay (randomized as well, so that clients
+    // do not all reach the image service at the same time)
+    NSTimeInterval delay = self.controller.reconnectionDelay * arc4random_uniform(1001) / 1000.;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+        if ([self.artworkCache removeFailedImages]) {
+            [self invalidateNowPlayingStaticInformation];
             [self updateNowPlayingInformationWithController:self.controller];
         }
-    }
+    });
 }
 
 #pragma mark Description
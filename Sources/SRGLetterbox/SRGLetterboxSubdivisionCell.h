@@ -59,6 +59,11 @@ API_UNAVAILABLE(tvos)
  */
 @property (nonatomic, weak, nullable) id<SRGLetterboxSubdivisionCellDelegate> delegate;
 
+/**
+ *  Cancel any pending image request (e.g. when the cell is not displayed anymore).
+ */
+- (void)cancelImageRequest;
+
 @end
 
 NS_ASSUME_NONNULL_END
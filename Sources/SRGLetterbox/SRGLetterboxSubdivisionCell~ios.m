@@ -234,6 +234,13 @@
     self.contentView.frame = self.bounds;
 }
 
+#pragma mark Image retrieval
+
+- (void)cancelImageRequest
+{
+    [self.imageView srg_resetImage];
+}
+
 #pragma mark Getters and setters
 
 - (void)setSubdivision:(SRGSubdivision *)subdivision controller:(SRGLetterboxController *)controller
@@ -243,7 +250,7 @@
     self.titleLabel.text = subdivision.title;
     self.titleLabel.font = [SRGFont fontWithStyle:SRGFontStyleCaption];
     
-    [self.imageView srg_requestImage:subdivision.image withSize:SRGImageSizeMedium controller:controller];
+    [self.imageView srg_requestImage:subdivision.image withSize:SRGImageSizeMedium priority:SRGLetterboxImagePriorityVisible controller:controller];
     
     self.durationLabel.font = [SRGFont fontWithStyle:SRGFontStyleCaption];
     self.durationLabel.backgroundColor = [UIColor colorWithWhite:0.f alpha:0.5f];
@@ -314,6 +314,13 @@ static const CGFloat SRGLetterboxCellMargin = 3.f;
     [self updateAppearanceForCell:cell];
 }
 
+- (void)collectionView:(UICollectionView *)collectionView didEndDisplayingCell:(SRGLetterboxSubdivisionCell *)cell forItemAtIndexPath:(NSIndexPath *)indexPath
+{
+    // Do not let off-screen cells compete with visible ones for image downloads. Images are requested again when cells
+    // are displayed.
+    [cell cancelImageRequest];
+}
+
 #pragma mark UICollectionViewDelegateFlowLayout protocol
 
 - (UIEdgeInsets)collectionView:(UICollectionView *)collectionView layout:(UICollectionViewFlowLayout *)collectionViewLayout insetForSectionAtIndex:(NSInteger)section
@@ -16,6 +16,7 @@
 #import "SRGErrorView.h"
 #import "SRGLetterboxController+Private.h"
 #import "SRGLetterboxError.h"
+#import "SRGLetterboxImageLoader.h"
 #import "SRGLetterboxMetadata.h"
 #import "SRGLiveLabel.h"
 #import "SRGNotificationView.h"
@@ -65,12 +66,26 @@ static UIView *SRGLetterboxViewControllerLoadingIndicatorSubview(UIView *view)
 
 static NSMutableSet<SRGLetterboxViewController *> *s_letterboxViewControllers;
 
+// PNG encoding is expensive. Encoded artwork data is therefore shared between all Letterbox view controllers.
+static NSCache<NSString *, NSData *> *SRGLetterboxViewControllerImageDataCache(void)
+{
+    static NSCache<NSString *, NSData *> *s_imageDataCache;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        s_imageDataCache = [[NSCache alloc] init];
+        s_imageDataCache.name = @"ch.srgssr.letterbox.imageData";
+        s_imageDataCache.totalCostLimit = 20 * 1024 * 1024;
+    });
+    return s_imageDataCache;
+}
+
 @interface SRGLetterboxViewController () <SRGContinuousPlaybackViewControllerDelegate, SRGMediaPlayerViewControllerDelegate>
 
 @property (nonatomic) SRGLetterboxController *controller;
 @property (nonatomic) SRGMediaPlayerViewController *playerViewController;
 
 @property (nonatomic) NSMutableDictionary<NSURL *, YYWebImageOperation *> *imageOperations;
+@property (nonatomic) NSMutableDictionary<NSString *, NSArray<AVMetadataItem *> *> *navigationMarkerItems;      // Segment URN as key
 
 @property (nonatomic, weak) UIImageView *imageView;
 @property (nonatomic, weak) SRGAvailabilityView *availabilityView;
@@ -123,6 +138,7 @@ static NSMutableSet<SRGLetterboxViewController *> *s_letterboxViewControllers;
         self.userInterfaceHidden = YES;
         
         self.imageOperations = [NSMutableDictionary dictionary];
+        self.navigationMarkerItems = [NSMutableDictionary dictionary];
         
         @weakify(self) @weakify(controller)
         [controller addObserver:self keyPath:@keypath(controller.continuousPlaybackUpcomingMedia) options:0 block:^(MAKVONotification *notification) {
@@ -364,27 +380,42 @@ static NSMutableSet<SRGLetterboxViewController *> *s_letterboxViewControllers;
 
 #pragma mark Image retrieval
 
-- (UIImage *)imageFromImage:(SRGImage *)fromImage withCompletion:(void (^)(void))completion
+static const SRGImageSize kImageSize = SRGImageSizeMedium;
+static const SRGImageVariant kImageVariant = SRGImageVariantDefault;
+
+// Return PNG data for the specified image, or `nil` if not available yet (in which case the completion block is called
+// when the image has been retrieved)
+- (NSData *)imageDataFromImage:(SRGImage *)fromImage priority:(SRGLetterboxImagePriority)priority withCompletion:(void (^)(void))completion
 {
     NSParameterAssert(completion);
     
-    static const SRGImageSize kImageSize = SRGImageSizeMedium;
-    static const SRGImageVariant kImageVariant = SRGImageVariantDefault;
+    NSURL *imageURL = [self.controller URLForImage:fromImage withSize:kImageSize];
+    if (! imageURL) {
+        return nil;
+    }
+    
+    NSCache<NSString *, NSData *> *imageDataCache = SRGLetterboxViewControllerImageDataCache();
+    NSString *imageDataKey = [NSString stringWithFormat:@"%@_%@", imageURL.absoluteString, @(kImageSize)];
+    NSData *imageData = [imageDataCache objectForKey:imageDataKey];
+    if (imageData) {
+        return imageData;
+    }
     
     YYWebImageManager *webImageManager = [YYWebImageManager sharedManager];
     
-    NSURL *imageURL = [self.controller URLForImage:fromImage withSize:kImageSize];
-    if (imageURL) {
-        NSString *key = [webImageManager cacheKeyForURL:imageURL];
-        UIImage *image = [webImageManager.cache getImageForKey:key];
-        if (image) {
-            return image;
+    NSString *key = [webImageManager cacheKeyForURL:imageURL];
+    UIImage *image = [webImageManager.cache getImageForKey:key withType:YYImageCacheTypeMemory];
+    if (image) {
+        imageData = UIImagePNGRepresentation(image);
+        if (imageData) {
+            [imageDataCache setObject:imageData forKey:imageDataKey cost:imageData.length];
         }
+        return imageData;
     }
     
-    if (imageURL && ! self.imageOperations[imageURL]) {
+    if (! self.imageOperations[imageURL]) {
         @weakify(self)
-        YYWebImageOperation *imageOperation = [webImageManager requestImageWithURL:imageURL options:0 progress:nil transform:nil completion:^(UIImage * _Nullable image, NSURL * _Nonnull url, YYWebImageFromType from, YYWebImageStage stage, NSError * _Nullable error) {
+        YYWebImageOperation *imageOperation = [SRGLetterboxImageLoader requestImageWithURL:imageURL priority:priority completion:^(UIImage * _Nullable image, NSURL * _Nonnull url, YYWebImageFromType from, YYWebImageStage stage, NSError * _Nullable error) {
             @strongify(self)
             dispatch_async(dispatch_get_main_queue(), ^{
                 self.imageOperations[imageURL] = nil;
@@ -394,20 +425,35 @@ static NSMutableSet<SRGLetterboxViewController *> *s_letterboxViewControllers;
         self.imageOperations[imageURL] = imageOperation;
     }
     
-    SRGImageWidth width = SRGRecommendedImageWidth(kImageSize, kImageVariant);
-    return [UIImage srg_vectorImageAtPath:SRGLetterboxFilePathForImagePlaceholder() withWidth:width];
+    return nil;
+}
+
+- (NSData *)placeholderImageData
+{
+    NSCache<NSString *, NSData *> *imageDataCache = SRGLetterboxViewControllerImageDataCache();
+    NSString *imageDataKey = [NSString stringWithFormat:@"placeholder_%@", @(kImageSize)];
+    NSData *imageData = [imageDataCache objectForKey:imageDataKey];
+    if (! imageData) {
+        SRGImageWidth width = SRGRecommendedImageWidth(kImageSize, kImageVariant);
+        UIImage *image = [UIImage srg_letterboxVectorImageAtPath:SRGLetterboxFilePathForImagePlaceholder() withWidth:width tintColor:nil];
+        imageData = UIImagePNGRepresentation(image);
+        if (imageData) {
+            [imageDataCache setObject:imageData forKey:imageDataKey cost:imageData.length];
+        }
+    }
+    return imageData;
 }
 
 #pragma mark Data
 
 - (void)reloadImage
 {
-    [self.imageView srg_requestImage:self.controller.displayableMedia.image withSize:SRGImageSizeLarge controller:self.controller];
+    [self.imageView srg_requestImage:self.controller.displayableMedia.image withSize:SRGImageSizeLarge priority:SRGLetterboxImagePriorityPoster controller:self.controller];
 }
 
 - (void)reloadPlaceholderImage
 {
-    [self.imageView srg_requestImage:nil withSize:SRGImageSizeLarge controller:self.controller];
+    [self.imageView srg_requestImage:nil withSize:SRGImageSizeLarge priority:SRGLetterboxImagePriorityPoster controller:self.controller];
 }
 
 #pragma mark Layout
@@ -697,13 +743,13 @@ static NSMutableSet<SRGLetterboxViewController *> *s_letterboxViewControllers;
         descriptionItem.value = SRGLetterboxMetadataDescription(media);
         descriptionItem.extendedLanguageTag = @"und";
         
-        UIImage *image = [self imageFromImage:media.image withCompletion:^{
+        NSData *imageData = [self imageDataFromImage:media.image priority:SRGLetterboxImagePriorityPoster withCompletion:^{
             [playerViewController reloadData];
         }];
         
         AVMutableMetadataItem *artworkItem = [[AVMutableMetadataItem alloc] init];
         artworkItem.identifier = AVMetadataCommonIdentifierArtwork;
-        artworkItem.value = UIImagePNGRepresentation(image);
+        artworkItem.value = imageData ?: [self placeholderImageData];
         artworkItem.extendedLanguageTag = @"und";       // Also required for images in external metadata
         
         return @[ titleItem.copy, subtitleItem.copy, descriptionItem.copy, artworkItem.copy ];
@@ -718,22 +764,32 @@ static NSMutableSet<SRGLetterboxViewController *> *s_letterboxViewControllers;
     NSMutableArray<AVTimedMetadataGroup *> *navigationMarkers = [NSMutableArray array];
     
     for (SRGSegment *segment in segments) {
-        AVMutableMetadataItem *titleItem = [[AVMutableMetadataItem alloc] init];
-        titleItem.identifier = AVMetadataCommonIdentifierTitle;
-        titleItem.value = segment.title;
-        titleItem.extendedLanguageTag = @"und";
-        
-        UIImage *image = [self imageFromImage:segment.image withCompletion:^{
-            [playerViewController reloadData];
-        }];
-        
-        AVMutableMetadataItem *artworkItem = [[AVMutableMetadataItem alloc] init];
-        artworkItem.identifier = AVMetadataCommonIdentifierArtwork;
-        artworkItem.value = UIImagePNGRepresentation(image);
-        artworkItem.extendedLanguageTag = @"und";       // Apparently not required, but added for safety / consistency
+        // Items are only built once per segment with its artwork available. Segments still waiting for their artwork are
+        // rebuilt (with the cached placeholder data) each time
+        NSArray<AVMetadataItem *> *items = self.navigationMarkerItems[segment.URN];
+        if (! items) {
+            AVMutableMetadataItem *titleItem = [[AVMutableMetadataItem alloc] init];
+            titleItem.identifier = AVMetadataCommonIdentifierTitle;
+            titleItem.value = segment.title;
+            titleItem.extendedLanguageTag = @"und";
+            
+            NSData *imageData = [self imageDataFromImage:segment.image priority:SRGLetterboxImagePriorityVisible withCompletion:^{
+                [playerViewController reloadData];
+            }];
+            
+            AVMutableMetadataItem *artworkItem = [[AVMutableMetadataItem alloc] init];
+            artworkItem.identifier = AVMetadataCommonIdentifierArtwork;
+            artworkItem.value = imageData ?: [self placeholderImageData];
+            artworkItem.extendedLanguageTag = @"und";       // Apparently not required, but added for safety / consistency
+            
+            items = @[ titleItem.copy, artworkItem.copy ];
+            if (imageData && segment.URN) {
+                self.navigationMarkerItems[segment.URN] = items;
+            }
+        }
         
         CMTimeRange segmentTimeRange = [segment.srg_markRange timeRangeForMediaPlayerController:playerViewController.controller];
-        AVTimedMetadataGroup *navigationMarker = [[AVTimedMetadataGroup alloc] initWithItems:@[ titleItem.copy, artworkItem.copy ] timeRange:segmentTimeRange];
+        AVTimedMetadataGroup *navigationMarker = [[AVTimedMetadataGroup alloc] initWithItems:items timeRange:segmentTimeRange];
         [navigationMarkers addObject:navigationMarker];
     }
     
@@ -744,6 +800,8 @@ static NSMutableSet<SRGLetterboxViewController *> *s_letterboxViewControllers;
 
 - (void)metadataDidChange:(NSNotification *)notification
 {
+    // Segment titles or images might have changed
+    [self.navigationMarkerItems removeAllObjects];
     [self.playerViewController reloadData];
     [self reloadImage];
     [self updateMainLayoutAnimated:YES];
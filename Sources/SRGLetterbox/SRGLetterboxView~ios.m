@@ -399,8 +399,24 @@ static const CGFloat kBottomConstraintLesserPriority = 850.f;
     self.timelineView.controller = controller;
     
     [self registerObservers];
+    [self attachMediaPlayerView];
+    [self setNeedsLayoutAnimated:NO];
+}
+
+- (void)didReattachToController
+{
+    [super didReattachToController];
     
-    UIView *mediaPlayerView = controller.mediaPlayerController.view;
+    // The player view might have been moved to another view in the meantime
+    if (self.controller.mediaPlayerController.view.superview != self.playbackView) {
+        [self attachMediaPlayerView];
+        [self setNeedsLayoutAnimated:NO];
+    }
+}
+
+- (void)attachMediaPlayerView
+{
+    UIView *mediaPlayerView = self.controller.mediaPlayerController.view;
     if (mediaPlayerView) {
         [self.playbackView insertSubview:mediaPlayerView atIndex:0];
         
@@ -415,15 +431,13 @@ static const CGFloat kBottomConstraintLesserPriority = 850.f;
         
         [self.playbackView layoutIfNeeded];
     }
-    
-    [self setNeedsLayoutAnimated:NO];
 }
 
 - (void)metadataDidChange
 {
     [super metadataDidChange];
     
-    [self.imageView srg_requestImage:self.controller.displayableMedia.image withSize:SRGImageSizeLarge controller:self.controller];
+    [self.imageView srg_requestImage:self.controller.displayableMedia.image withSize:SRGImageSizeLarge priority:SRGLetterboxImagePriorityPoster controller:self.controller];
 }
 
 - (void)playbackDidFail
@@ -1192,7 +1206,7 @@ static const CGFloat kBottomConstraintLesserPriority = 850.f;
     // Provide immediate updates during seeks only, otherwise rely on usual image updates (`-metadataDidChange:`)
     if (self.controller.playbackState == SRGMediaPlayerPlaybackStateSeeking) {
         id<SRGMediaMetadata> mediaMetadata = subdivision ?: self.controller.displayableMedia;
-        [self.imageView srg_requestImage:mediaMetadata.image withSize:SRGImageSizeLarge controller:self.controller];
+        [self.imageView srg_requestImage:mediaMetadata.image withSize:SRGImageSizeLarge priority:SRGLetterboxImagePriorityPoster controller:self.controller];
     }
 }
 
@@ -29,6 +29,37 @@ OBJC_EXPORT NSString *SRGLetterboxFilePathForImagePlaceholder(void);
  */
 OBJC_EXPORT NSURL * _Nullable SRGLetterboxImageURL(SRGImage * _Nullable image, SRGImageSize size, SRGLetterboxController * _Nullable controller);
 
+/**
+ *  Vector images (PDFs) rasterised at a given width (in points, the height being calculated from the image aspect ratio),
+ *  optionally tinted. Rasterised images are kept in memory and persisted to disk, so that rasterisation happens at most
+ *  once per image, width, screen scale and tint color.
+ *
+ *  @discussion Must be called from the main thread.
+ */
+@interface UIImage (SRGLetterboxVectorImages)
+
+/**
+ *  Return the image if readily available from the memory cache, `nil` otherwise.
+ */
++ (nullable UIImage *)srg_letterboxCachedVectorImageAtPath:(NSString *)filePath withWidth:(CGFloat)width tintColor:(nullable UIColor *)tintColor;
+
+/**
+ *  Return the image, loading it from the disk cache or rasterising it synchronously if needed. Use only when the image is
+ *  required immediately.
+ */
++ (nullable UIImage *)srg_letterboxVectorImageAtPath:(NSString *)filePath withWidth:(CGFloat)width tintColor:(nullable UIColor *)tintColor;
+
+/**
+ *  Retrieve the image, loading it from the disk cache or rasterising it on a background queue if needed. The completion
+ *  block is called on the main thread.
+ */
++ (void)srg_letterboxRequestVectorImageAtPath:(NSString *)filePath
+                                    withWidth:(CGFloat)width
+                                    tintColor:(nullable UIColor *)tintColor
+                                   completion:(nullable void (^)(UIImage * _Nullable image))completion;
+
+@end
+
 /**
  *  Standard images from Letterbox bundle.
  */
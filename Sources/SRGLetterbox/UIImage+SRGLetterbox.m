@@ -8,6 +8,7 @@
 
 #import "NSError+SRGLetterbox.h"
 #import "SRGLetterboxController+Private.h"
+#import "SRGLetterbox.h"
 #import "SRGLetterboxError.h"
 
 @import SRGDataProviderNetwork;
@@ -44,96 +45,192 @@ NSURL *SRGLetterboxImageURL(SRGImage *image, SRGImageSize size, SRGLetterboxCont
     return SRGLetterboxSupportedURL(URL);
 }
 
-static CGFloat SRGImageAspectScaleFit(CGSize sourceSize, CGRect destRect)
+// Bump when rasterisation changes, so that images persisted by previous versions are discarded
+static const NSInteger SRGLetterboxVectorImageCacheVersion = 1;
+
+static NSURL *SRGLetterboxVectorImageCacheDirectoryURL(void)
 {
-    CGSize destSize = destRect.size;
-    CGFloat scaleW = destSize.width / sourceSize.width;
-    CGFloat scaleH = destSize.height / sourceSize.height;
-    return fmin(scaleW, scaleH);
+    static NSURL *s_directoryURL;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        NSURL *cachesDirectoryURL = [NSFileManager.defaultManager URLsForDirectory:NSCachesDirectory inDomains:NSUserDomainMask].firstObject;
+        NSURL *rootDirectoryURL = [cachesDirectoryURL URLByAppendingPathComponent:@"ch.srgssr.letterbox.vectorImages"];
+        NSString *versionComponent = [NSString stringWithFormat:@"v%@-%@", @(SRGLetterboxVectorImageCacheVersion), SRGLetterboxMarketingVersion()];
+        s_directoryURL = [rootDirectoryURL URLByAppendingPathComponent:versionComponent];
+        
+        // Remove images persisted by other versions
+        NSArray<NSURL *> *directoryURLs = [NSFileManager.defaultManager contentsOfDirectoryAtURL:rootDirectoryURL includingPropertiesForKeys:nil options:0 error:NULL];
+        for (NSURL *directoryURL in directoryURLs) {
+            if (! [directoryURL.lastPathComponent isEqualToString:versionComponent]) {
+                [NSFileManager.defaultManager removeItemAtURL:directoryURL error:NULL];
+            }
+        }
+        [NSFileManager.defaultManager createDirectoryAtURL:s_directoryURL withIntermediateDirectories:YES attributes:nil error:NULL];
+    });
+    return s_directoryURL;
 }
 
-static CGRect SRGImageRectAroundCenter(CGPoint center, CGSize size)
+static NSCache<NSString *, UIImage *> *SRGLetterboxVectorImageMemoryCache(void)
 {
-    return CGRectMake(center.x - size.width / 2.f, center.y - size.height / 2.f, size.width, size.height);
+    static NSCache<NSString *, UIImage *> *s_cache;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        s_cache = [[NSCache alloc] init];
+        s_cache.name = @"ch.srgssr.letterbox.vectorImages";
+    });
+    return s_cache;
 }
 
-static CGRect SRGImageRectByFittingRect(CGRect sourceRect, CGRect destinationRect)
+static dispatch_queue_t SRGLetterboxVectorImageQueue(void)
 {
-    CGFloat aspect = SRGImageAspectScaleFit(sourceRect.size, destinationRect);
-    CGSize targetSize = CGSizeMake(sourceRect.size.width * aspect, sourceRect.size.height * aspect);
-    CGPoint center = CGPointMake(CGRectGetMidX(destinationRect), CGRectGetMidY(destinationRect));
-    return SRGImageRectAroundCenter(center, targetSize);
+    static dispatch_queue_t s_queue;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        s_queue = dispatch_queue_create("ch.srgssr.letterbox.vectorImages", DISPATCH_QUEUE_SERIAL_WITH_AUTORELEASE_POOL);
+        dispatch_set_target_queue(s_queue, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0));
+    });
+    return s_queue;
 }
 
-static void SRGImageDrawPDFPageInRect(CGPDFPageRef pageRef, CGRect rect)
+// Must be called from the main thread (screen scale)
+static NSString *SRGLetterboxVectorImageKey(NSString *filePath, CGFloat width, UIColor *tintColor)
 {
-    CGContextRef context = UIGraphicsGetCurrentContext();
-    
-    CGContextSaveGState(context);
-    UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+    CGFloat red = 0.f, green = 0.f, blue = 0.f, alpha = 0.f;
+    [tintColor getRed:&red green:&green blue:&blue alpha:&alpha];
+    NSString *tintComponent = tintColor ? [NSString stringWithFormat:@"%02X%02X%02X%02X", (int)round(red * 255), (int)round(green * 255), (int)round(blue * 255), (int)round(alpha * 255)] : @"none";
+    return [NSString stringWithFormat:@"%@_%@@%@x_%@", filePath.lastPathComponent.stringByDeletingPathExtension, @(width), @(UIScreen.mainScreen.scale), tintComponent];
+}
+
+static UIImage *SRGLetterboxVectorImageFromDisk(NSString *key, CGFloat scale)
+{
+    NSURL *fileURL = [[SRGLetterboxVectorImageCacheDirectoryURL() URLByAppendingPathComponent:key] URLByAppendingPathExtension:@"png"];
+    NSData *data = [NSData dataWithContentsOfURL:fileURL];
+    return data ? [UIImage imageWithData:data scale:scale] : nil;
+}
+
+// Thread-safe. The image height is calculated from the PDF aspect ratio.
+static UIImage *SRGLetterboxVectorImageRasterized(NSString *filePath, CGFloat width, CGFloat scale, UIColor *tintColor)
+{
+    CGPDFDocumentRef pdfDocumentRef = CGPDFDocumentCreateWithURL((__bridge CFURLRef)[NSURL fileURLWithPath:filePath]);
+    if (! pdfDocumentRef) {
+        return nil;
+    }
     
-    // Flip the context to Quartz space
-    CGAffineTransform transform = CGAffineTransformIdentity;
-    transform = CGAffineTransformScale(transform, 1.f, -1.f);
-    transform = CGAffineTransformTranslate(transform, 0.f, -image.size.height);
-    CGContextConcatCTM(context, transform);
+    CGPDFPageRef pageRef = CGPDFDocumentGetPage(pdfDocumentRef, 1);
+    CGRect pageRect = CGPDFPageGetBoxRect(pageRef, kCGPDFCropBox);
+    if (CGRectIsEmpty(pageRect)) {
+        CGPDFDocumentRelease(pdfDocumentRef);
+        return nil;
+    }
     
-    // Flip the rect, which remains in UIKit space
-    CGRect d = CGRectApplyAffineTransform(rect, transform);
+    CGFloat ratio = width / CGRectGetWidth(pageRect);
+    CGSize size = CGSizeMake(width, round(CGRectGetHeight(pageRect) * ratio));
     
-    // Calculate a rectangle to draw to
-    CGRect pageRect = CGPDFPageGetBoxRect(pageRef, kCGPDFCropBox);
-    CGFloat drawingAspect = SRGImageAspectScaleFit(pageRect.size, d);
-    CGRect drawingRect = SRGImageRectByFittingRect(pageRect, d);
+    UIGraphicsImageRendererFormat *format = [UIGraphicsImageRendererFormat preferredFormat];
+    format.scale = scale;
     
-    // Adjust the context
-    CGContextTranslateCTM(context, drawingRect.origin.x, drawingRect.origin.y);
-    CGContextScaleCTM(context, drawingAspect, drawingAspect);
+    UIGraphicsImageRenderer *renderer = [[UIGraphicsImageRenderer alloc] initWithSize:size format:format];
+    UIImage *image = [renderer imageWithActions:^(UIGraphicsImageRendererContext * _Nonnull rendererContext) {
+        CGContextRef context = rendererContext.CGContext;
+        
+        // Flip the context to Quartz space and scale the page to fit
+        CGContextSaveGState(context);
+        CGContextTranslateCTM(context, 0.f, size.height);
+        CGContextScaleCTM(context, ratio, -ratio);
+        CGContextTranslateCTM(context, -CGRectGetMinX(pageRect), -CGRectGetMinY(pageRect));
+        CGContextDrawPDFPage(context, pageRef);
+        CGContextRestoreGState(context);
+        
+        if (tintColor) {
+            [tintColor setFill];
+            UIRectFillUsingBlendMode(CGRectMake(0.f, 0.f, size.width, size.height), kCGBlendModeSourceIn);
+        }
+    }];
     
-    // Draw the page
-    CGContextDrawPDFPage(context, pageRef);
-    CGContextRestoreGState(context);
+    CGPDFDocumentRelease(pdfDocumentRef);
+    return image;
 }
 
-@implementation UIImage (SRGLetterbox)
-
-// Implementation borrowed from https://github.com/erica/useful-things
-+ (UIImage *)srg_vectorImageNamed:(NSString *)imageName inBundle:(NSBundle *)bundle withSize:(CGSize)size
+__attribute__((constructor)) static void SRGLetterboxVectorImagePrewarm(void)
 {
-    static NSCache<NSString *, UIImage *> *s_cache = nil;
-    static dispatch_once_t onceToken;
-    dispatch_once(&onceToken, ^{
-        s_cache = [[NSCache alloc] init];
+    // Rasterise placeholders at their most common sizes in advance, so that the first player presentation after launch
+    // does not have to pay for it
+    dispatch_async(dispatch_get_main_queue(), ^{
+        for (NSNumber *size in @[ @(SRGImageSizeMedium), @(SRGImageSizeLarge) ]) {
+            SRGImageWidth width = SRGRecommendedImageWidth(size.integerValue, SRGImageVariantDefault);
+            [UIImage srg_letterboxRequestVectorImageAtPath:SRGLetterboxFilePathForImagePlaceholder() withWidth:width tintColor:nil completion:nil];
+        }
     });
-    
-    if (!bundle) {
-        bundle = NSBundle.mainBundle;
+}
+
+@implementation UIImage (SRGLetterboxVectorImages)
+
++ (UIImage *)srg_letterboxCachedVectorImageAtPath:(NSString *)filePath withWidth:(CGFloat)width tintColor:(UIColor *)tintColor
+{
+    NSString *key = SRGLetterboxVectorImageKey(filePath, width, tintColor);
+    return [SRGLetterboxVectorImageMemoryCache() objectForKey:key];
+}
+
++ (UIImage *)srg_letterboxVectorImageAtPath:(NSString *)filePath withWidth:(CGFloat)width tintColor:(UIColor *)tintColor
+{
+    NSString *key = SRGLetterboxVectorImageKey(filePath, width, tintColor);
+    NSCache<NSString *, UIImage *> *memoryCache = SRGLetterboxVectorImageMemoryCache();
+    UIImage *image = [memoryCache objectForKey:key];
+    if (image) {
+        return image;
     }
     
-    NSString *key = [NSString stringWithFormat:@"%@_%@_%@_%@", imageName, @(size.width), @(size.height), bundle.bundleIdentifier];
-    UIImage *cachedImage = [s_cache objectForKey:key];
-    if (cachedImage) {
-        return cachedImage;
+    CGFloat scale = UIScreen.mainScreen.scale;
+    image = SRGLetterboxVectorImageFromDisk(key, scale);
+    if (! image) {
+        image = SRGLetterboxVectorImageRasterized(filePath, width, scale, tintColor);
+        
+        NSData *data = UIImagePNGRepresentation(image);
+        if (data) {
+            dispatch_async(SRGLetterboxVectorImageQueue(), ^{
+                NSURL *fileURL = [[SRGLetterboxVectorImageCacheDirectoryURL() URLByAppendingPathComponent:key] URLByAppendingPathExtension:@"png"];
+                [data writeToURL:fileURL atomically:YES];
+            });
+        }
     }
     
-    NSURL *fileURL = [bundle URLForResource:imageName withExtension:@"pdf"];
-    CGPDFDocumentRef pdfDocumentRef = CGPDFDocumentCreateWithURL((__bridge CFURLRef)fileURL);
-    if (! pdfDocumentRef) {
-        return nil;
+    if (image) {
+        [memoryCache setObject:image forKey:key];
     }
-    
-    UIGraphicsBeginImageContextWithOptions(size, NO, 0);
-    CGPDFPageRef pageRef = CGPDFDocumentGetPage(pdfDocumentRef, 1);
-    SRGImageDrawPDFPageInRect(pageRef, CGRectMake(0.f, 0.f, size.width, size.height));
-    UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
-    UIGraphicsEndImageContext();
-    
-    CGPDFDocumentRelease(pdfDocumentRef);
-    
-    [s_cache setObject:image forKey:key];
     return image;
 }
 
++ (void)srg_letterboxRequestVectorImageAtPath:(NSString *)filePath withWidth:(CGFloat)width tintColor:(UIColor *)tintColor completion:(void (^)(UIImage * _Nullable))completion
+{
+    NSString *key = SRGLetterboxVectorImageKey(filePath, width, tintColor);
+    NSCache<NSString *, UIImage *> *memoryCache = SRGLetterboxVectorImageMemoryCache();
+    UIImage *image = [memoryCache objectForKey:key];
+    if (image) {
+        completion ? completion(image) : nil;
+        return;
+    }
+    
+    CGFloat scale = UIScreen.mainScreen.scale;
+    dispatch_async(SRGLetterboxVectorImageQueue(), ^{
+        // Requests are processed serially. A previous request might have already made the image available.
+        UIImage *image = [memoryCache objectForKey:key] ?: SRGLetterboxVectorImageFromDisk(key, scale);
+        if (! image) {
+            image = SRGLetterboxVectorImageRasterized(filePath, width, scale, tintColor);
+            
+            NSURL *fileURL = [[SRGLetterboxVectorImageCacheDirectoryURL() URLByAppendingPathComponent:key] URLByAppendingPathExtension:@"png"];
+            [UIImagePNGRepresentation(image) writeToURL:fileURL atomically:YES];
+        }
+        
+        if (image) {
+            [memoryCache setObject:image forKey:key];
+        }
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            completion ? completion(image) : nil;
+        });
+    });
+}
+
 @end
 
 @implementation UIImage (SRGLetterboxImages)
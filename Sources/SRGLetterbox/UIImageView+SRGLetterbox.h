@@ -5,6 +5,7 @@
 //
 
 #import "SRGLetterboxController.h"
+#import "SRGLetterboxImageLoader.h"
 #import "UIImage+SRGLetterbox.h"
 
 @import SRGDataProvider;
@@ -23,6 +24,7 @@ NS_ASSUME_NONNULL_BEGIN
  *
  *  @param image                 The image to request.
  *  @param size                  The image size.
+ *  @param priority              The request priority.
  *  @param controller            The controller for which image retrieval is made.
  *  @param unavailabilityHandler An optional handler called when the image is invalid (no object was provided or its
  *                               associated image is invalid). You can implement this block to respond to such cases,
@@ -33,15 +35,17 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)srg_requestImage:(nullable SRGImage *)image
                 withSize:(SRGImageSize)size
+                priority:(SRGLetterboxImagePriority)priority
               controller:(nullable SRGLetterboxController *)controller
    unavailabilityHandler:(nullable void (^)(void))unavailabilityHandler;
 
 /**
- *  Same as `-srg_requestImage:withSize:unavailabilityHandler:`, with no unavailability handler (thus
+ *  Same as `-srg_requestImage:withSize:priority:controller:unavailabilityHandler:`, with no unavailability handler (thus
  *  setting the default placeholder if no image is available).
  */
 - (void)srg_requestImage:(nullable SRGImage *)image
                 withSize:(SRGImageSize)size
+                priority:(SRGLetterboxImagePriority)priority
               controller:(nullable SRGLetterboxController *)controller;
 
 /**
@@ -13,6 +13,49 @@
 @import SRGAppearance;
 @import YYWebImage;
 
+// Granularity of downsampled image sizes (in pixels), so that small layout changes do not lead to new requests
+static const CGFloat SRGLetterboxImagePixelSizeGranularity = 100.f;
+
+// Return the URL to use for an image displayed at the specified pixel size. Since downsampled images are cached, the size
+// must be part of the cache key. It is added as fragment, which is never sent to the server. The original image is shared
+// by all sizes through the URL cache (see `YYWebImageOptionUseNSURLCache`), so that it is downloaded only once.
+static NSURL *SRGLetterboxImageURLForPixelSize(NSURL *URL, CGSize pixelSize)
+{
+    NSURLComponents *URLComponents = [NSURLComponents componentsWithURL:URL resolvingAgainstBaseURL:NO];
+    URLComponents.fragment = [NSString stringWithFormat:@"srgletterbox_size=%@x%@", @(pixelSize.width), @(pixelSize.height)];
+    return URLComponents.URL ?: URL;
+}
+
+// Transform block scaling down images so that they fill the specified pixel size (never upscaling them), and drawing them
+// into bitmaps, so that no decoding is required when they are first displayed. Executed on a background thread.
+static YYWebImageTransformBlock SRGLetterboxImageDownsamplingTransformBlock(CGSize pixelSize)
+{
+    return ^UIImage * _Nullable(UIImage * _Nonnull image, NSURL * _Nonnull url) {
+        CGSize imagePixelSize = CGSizeMake(image.size.width * image.scale, image.size.height * image.scale);
+        if (imagePixelSize.width == 0.f || imagePixelSize.height == 0.f) {
+            return image;
+        }
+        
+        CGFloat ratio = fmax(pixelSize.width / imagePixelSize.width, pixelSize.height / imagePixelSize.height);
+        if (ratio >= 1.f) {
+            return image;
+        }
+        
+        CGSize downsampledSize = CGSizeMake(ceil(imagePixelSize.width * ratio), ceil(imagePixelSize.height * ratio));
+        
+        UIGraphicsImageRendererFormat *format = [UIGraphicsImageRendererFormat preferredFormat];
+        format.scale = 1.f;
+        
+        CGImageAlphaInfo alphaInfo = CGImageGetAlphaInfo(image.CGImage);
+        format.opaque = (alphaInfo == kCGImageAlphaNone || alphaInfo == kCGImageAlphaNoneSkipFirst || alphaInfo == kCGImageAlphaNoneSkipLast);
+        
+        UIGraphicsImageRenderer *renderer = [[UIGraphicsImageRenderer alloc] initWithSize:downsampledSize format:format];
+        return [renderer imageWithActions:^(UIGraphicsImageRendererContext * _Nonnull rendererContext) {
+            [image drawInRect:CGRectMake(0.f, 0.f, downsampledSize.width, downsampledSize.height)];
+        }];
+    };
+}
+
 @implementation UIImageView (SRGLetterbox)
 
 #pragma mark Class methods
@@ -32,8 +75,41 @@
     return imageView;
 }
 
+// Tinted frames are shared by all image views, see `+srg_animatedImageNamed:withTintColor:`
++ (NSCache<NSString *, NSArray<UIImage *> *> *)srg_animatedImagesCache
+{
+    static NSCache<NSString *, NSArray<UIImage *> *> *s_cache;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        s_cache = [[NSCache alloc] init];
+        s_cache.name = @"ch.srgssr.letterbox.animatedImages";
+    });
+    return s_cache;
+}
+
 + (NSArray<UIImage *> *)srg_animatedImageNamed:(NSString *)name withTintColor:(UIColor *)tintColor
 {
+    // Frames depend on the name, the tint color and the traits used to load and tint them (dynamic colors and current
+    // traits are only available from iOS / tvOS 13 on)
+    UITraitCollection *traitCollection = nil;
+    UIColor *resolvedTintColor = tintColor;
+    NSString *traitsKey = @"";
+    if (@available(iOS 13, tvOS 13, *)) {
+        traitCollection = UITraitCollection.currentTraitCollection;
+        resolvedTintColor = [tintColor resolvedColorWithTraitCollection:traitCollection];
+        traitsKey = [NSString stringWithFormat:@"_%@_%@", @(traitCollection.displayScale), @(traitCollection.userInterfaceStyle)];
+    }
+    
+    CGFloat red = 0.f, green = 0.f, blue = 0.f, alpha = 0.f;
+    [resolvedTintColor getRed:&red green:&green blue:&blue alpha:&alpha];
+    NSString *key = [NSString stringWithFormat:@"%@_%@_%@_%@_%@_%@%@", name, @(red), @(green), @(blue), @(alpha), @(resolvedTintColor != nil), traitsKey];
+    
+    NSCache<NSString *, NSArray<UIImage *> *> *cache = [self srg_animatedImagesCache];
+    NSArray<UIImage *> *cachedImages = [cache objectForKey:key];
+    if (cachedImages) {
+        return cachedImages;
+    }
+    
     NSMutableArray<UIImage *> *images = [NSMutableArray array];
     
     NSInteger count = 0;
@@ -41,7 +117,7 @@
         NSString *imageName = [NSString stringWithFormat:@"%@-%@", name, @(count)];
         UIImage *image = [[UIImage imageNamed:imageName
                                      inBundle:SWIFTPM_MODULE_BUNDLE
-                compatibleWithTraitCollection:nil] srg_imageTintedWithColor:tintColor];
+                compatibleWithTraitCollection:traitCollection] srg_imageTintedWithColor:resolvedTintColor];
         if (! image) {
             break;
         }
@@ -51,6 +127,8 @@
     }
     
     NSAssert(images.count != 0, @"Invalid asset %@", name);
+    
+    [cache setObject:images.copy forKey:key];
     return images.copy;
 }
 
@@ -58,11 +136,15 @@
 
 - (void)srg_requestImage:(SRGImage *)image
                 withSize:(SRGImageSize)size
+                priority:(SRGLetterboxImagePriority)priority
               controller:(SRGLetterboxController *)controller
    unavailabilityHandler:(void (^)(void))unavailabilityHandler
 {
+    // Never rasterise the placeholder on the main thread. If not available yet, the placeholder background color is displayed
+    // until it is.
     SRGImageWidth width = SRGRecommendedImageWidth(size, SRGImageVariantDefault);
-    UIImage *placeholderImage = [UIImage srg_vectorImageAtPath:SRGLetterboxFilePathForImagePlaceholder() withWidth:width];
+    NSString *placeholderFilePath = SRGLetterboxFilePathForImagePlaceholder();
+    UIImage *placeholderImage = [UIImage srg_letterboxCachedVectorImageAtPath:placeholderFilePath withWidth:width tintColor:nil];
     
     NSURL *URL = SRGLetterboxImageURL(image, size, controller);
     if (! URL) {
@@ -72,10 +154,38 @@
         else {
             [self yy_setImageWithURL:nil placeholder:placeholderImage];
             self.backgroundColor = UIColor.srg_placeholderBackgroundGrayColor;
+            
+            if (! placeholderImage) {
+                [UIImage srg_letterboxRequestVectorImageAtPath:placeholderFilePath withWidth:width tintColor:nil completion:^(UIImage * _Nullable placeholderImage) {
+                    // Only set the placeholder if no other image has been requested in the meantime
+                    if (! self.yy_imageURL && ! self.image) {
+                        self.image = placeholderImage;
+                    }
+                }];
+            }
         }
         return;
     }
     
+    if (! placeholderImage) {
+        [UIImage srg_letterboxRequestVectorImageAtPath:placeholderFilePath withWidth:width tintColor:nil completion:nil];
+    }
+    
+    YYWebImageManager *webImageManager = [SRGLetterboxImageLoader webImageManagerWithPriority:priority];
+    
+    // Downsample images to the pixel size at which they are displayed, when known. If the original image is already in
+    // memory (e.g. prefetched), use it instead of requesting a downsampled version, so that it is displayed immediately.
+    YYWebImageOptions options = YYWebImageOptionSetImageWithFadeAnimation;
+    YYWebImageTransformBlock transform = nil;
+    if (! CGRectIsEmpty(self.bounds) && ! [webImageManager.cache containsImageForKey:[webImageManager cacheKeyForURL:URL] withType:YYImageCacheTypeMemory]) {
+        CGFloat scale = self.window.screen.scale ?: UIScreen.mainScreen.scale;
+        CGSize pixelSize = CGSizeMake(ceil(CGRectGetWidth(self.bounds) * scale / SRGLetterboxImagePixelSizeGranularity) * SRGLetterboxImagePixelSizeGranularity,
+                                      ceil(CGRectGetHeight(self.bounds) * scale / SRGLetterboxImagePixelSizeGranularity) * SRGLetterboxImagePixelSizeGranularity);
+        URL = SRGLetterboxImageURLForPixelSize(URL, pixelSize);
+        transform = SRGLetterboxImageDownsamplingTransformBlock(pixelSize);
+        options |= YYWebImageOptionUseNSURLCache;
+    }
+    
     YYWebImageCompletionBlock completion = ^(UIImage * _Nullable image, NSURL * _Nonnull url, YYWebImageFromType from, YYWebImageStage stage, NSError * _Nullable error) {
         self.backgroundColor = (! error && image) ? UIColor.clearColor : UIColor.srg_placeholderBackgroundGrayColor;
     };
@@ -84,21 +194,22 @@
         // If an image is already displayed, use it as placeholder. This make the transition smooth between both images.
         // Using the placeholder would add an unnecessary intermediate state leading to flickering
         if (self.image) {
-            [self yy_setImageWithURL:URL placeholder:self.image options:YYWebImageOptionSetImageWithFadeAnimation completion:completion];
+            [self yy_setImageWithURL:URL placeholder:self.image options:options manager:webImageManager progress:nil transform:transform completion:completion];
         }
-        // If no image is already displayed, check if the image we want to display is already available from the cache.
-        // If this is the case, use it as placeholder, avoiding an intermediate step which would lead to flickering
+        // If no image is already displayed, check if the image we want to display is already available from the memory cache.
+        // If this is the case, use it as placeholder, avoiding an intermediate step which would lead to flickering. The disk
+        // cache is not checked, as this would block the main thread (disk cache hits are quickly delivered by YYWebImage
+        // anyway).
         else {
-            YYWebImageManager *webImageManager = [YYWebImageManager sharedManager];
             NSString *key = [webImageManager cacheKeyForURL:URL];
-            UIImage *image = [webImageManager.cache getImageForKey:key];
+            UIImage *image = [webImageManager.cache getImageForKey:key withType:YYImageCacheTypeMemory];
             if (image) {
                 // Use the YYWebImage setter so that the URL is properly associated with the image view
-                [self yy_setImageWithURL:URL placeholder:image options:YYWebImageOptionSetImageWithFadeAnimation completion:completion];
+                [self yy_setImageWithURL:URL placeholder:image options:options manager:webImageManager progress:nil transform:transform completion:completion];
             }
             else {
                 self.backgroundColor = UIColor.srg_placeholderBackgroundGrayColor;
-                [self yy_setImageWithURL:URL placeholder:placeholderImage options:YYWebImageOptionSetImageWithFadeAnimation completion:completion];
+                [self yy_setImageWithURL:URL placeholder:placeholderImage options:options manager:webImageManager progress:nil transform:transform completion:completion];
             }
         }
     }
@@ -106,9 +217,10 @@
 
 - (void)srg_requestImage:(SRGImage *)image
                 withSize:(SRGImageSize)size
+                priority:(SRGLetterboxImagePriority)priority
               controller:(SRGLetterboxController *)controller
 {
-    [self srg_requestImage:image withSize:size controller:controller unavailabilityHandler:nil];
+    [self srg_requestImage:image withSize:size priority:priority controller:controller unavailabilityHandler:nil];
 }
 
 - (void)srg_resetImage
@@ -10,11 +10,14 @@
 FOUNDATION_EXPORT NSString * SRGLetterboxMarketingVersion(void);
 
 #import "NSLayoutConstraint+SRGLetterbox.h"
+#import "SRGLetterboxAutoplayManager.h"
 #import "SRGLetterboxBaseView.h"
 #import "SRGLetterboxController.h"
+#import "SRGLetterboxControllerPool.h"
 #import "SRGLetterboxControllerView.h"
 #import "SRGLetterboxError.h"
 #import "SRGLetterboxPlaybackSettings.h"
+#import "SRGLetterboxPositionStore.h"
 #import "SRGLetterboxService.h"
 #import "SRGLetterboxView.h"
 #import "SRGLetterboxViewController.h"
@@ -0,0 +1,96 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGLetterboxPlaybackSettings.h"
+#import "SRGLetterboxView.h"
+
+@import SRGDataProviderModel;
+@import UIKit;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Manages autoplay for Letterbox views displayed in a scroll view (e.g. table or collection view cells of a feed),
+ *  based on their visibility:
+ *    - The most visible views play, at most `maximumPlayingCount` at the same time.
+ *    - Other visible views are paused.
+ *    - The closest view about to scroll into the viewport is prepared in advance, so that it can start quickly.
+ *    - Views which scrolled out of the viewport are stopped and their player released (or merely paused, see
+ *      `releasesPlayersOutsideViewport`).
+ *
+ *  Register views with the media they must play when they are displayed (e.g. when configuring a cell) and unregister
+ *  them when they are not needed anymore (e.g. when the cell is reused). Controllers must be attached to registered
+ *  views, and are entirely managed by the manager while they are registered.
+ *
+ *  @discussion Visibility is updated automatically when the scroll view scrolls. Call `-updateVisibility` if the layout
+ *              changes for another reason. The controller currently used for picture in picture is never paused or
+ *              released.
+ */
+API_UNAVAILABLE(tvos)
+@interface SRGLetterboxAutoplayManager : NSObject
+
+/**
+ *  Create a manager for views displayed in the specified scroll view, playing at most `maximumPlayingCount` medias at
+ *  the same time.
+ */
+- (instancetype)initWithScrollView:(UIScrollView *)scrollView maximumPlayingCount:(NSUInteger)maximumPlayingCount;
+
+/**
+ *  The scroll view.
+ */
+@property (nonatomic, readonly, weak) UIScrollView *scrollView;
+
+/**
+ *  The maximum number of views playing at the same time.
+ */
+@property (nonatomic, readonly) NSUInteger maximumPlayingCount;
+
+/**
+ *  The fraction of a view which must be visible for it to play, between 0 and 1. Default value is 0.5.
+ */
+@property (nonatomic) CGFloat visibilityThreshold;
+
+/**
+ *  The distance (in points) from the viewport under which a view is prepared in advance. Default value is 200.
+ */
+@property (nonatomic) CGFloat preparationDistance;
+
+/**
+ *  If set to `YES`, views which scrolled out of the viewport (and out of the preparation distance) are stopped and their
+ *  player released. Playback resumes where it was left for on-demand medias. If set to `NO`, they are merely paused.
+ *
+ *  Default value is `YES`.
+ */
+@property (nonatomic) BOOL releasesPlayersOutsideViewport;
+
+/**
+ *  Register a view to be managed, with the media to play and optional playback settings.
+ *
+ *  @discussion Registering a view again replaces its media and settings.
+ */
+- (void)registerLetterboxView:(SRGLetterboxView *)letterboxView
+                    withMedia:(SRGMedia *)media
+            preferredSettings:(nullable SRGLetterboxPlaybackSettings *)preferredSettings;
+
+/**
+ *  Unregister a view. Its controller is reset.
+ */
+- (void)unregisterLetterboxView:(SRGLetterboxView *)letterboxView;
+
+/**
+ *  Update playback according to the current visibility of registered views.
+ */
+- (void)updateVisibility;
+
+@end
+
+@interface SRGLetterboxAutoplayManager (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
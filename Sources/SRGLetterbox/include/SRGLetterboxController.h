@@ -5,6 +5,7 @@
 //
 
 #import "SRGLetterboxPlaybackSettings.h"
+#import "SRGLetterboxPositionStore.h"
 
 @import SRGDataProvider;
 @import SRGMediaPlayer;
@@ -101,6 +102,13 @@ OBJC_EXPORT NSString * const SRGLetterboxPlaybackDidContinueAutomaticallyNotific
 static const NSTimeInterval SRGLetterboxDefaultUpdateInterval = 30.;
 static const NSTimeInterval SRGLetterboxMinimumUpdateInterval = 10.;
 
+/**
+ *  Standard time intervals for metadata retrieval around media start and end dates.
+ */
+static const NSTimeInterval SRGLetterboxDefaultScheduledUpdateLead = 10.;
+static const NSTimeInterval SRGLetterboxDefaultScheduledUpdateWindow = 50.;
+static const NSTimeInterval SRGLetterboxMaximumScheduledUpdateSpread = 100.;
+
 /**
  *  Standard skip interval.
  */
@@ -111,6 +119,27 @@ static const NSTimeInterval SRGLetterboxSkipInterval = 10.;
  */
 static const NSTimeInterval SRGLetterboxContinuousPlaybackDisabled = DBL_MAX;
 
+/**
+ *  Default time interval before the end of a media at which the next media is preloaded.
+ */
+static const NSTimeInterval SRGLetterboxDefaultUpcomingMediaPreloadInterval = 20.;
+
+/**
+ *  Controller priorities, used to decide which controllers keep their player when the active player budget is exceeded
+ *  (see `SRGLetterboxController (PlayerBudget)`). Any intermediate value can be used.
+ */
+typedef float SRGLetterboxControllerPriority;
+
+static const SRGLetterboxControllerPriority SRGLetterboxControllerPriorityLow = 250.f;
+static const SRGLetterboxControllerPriority SRGLetterboxControllerPriorityDefault = 500.f;
+static const SRGLetterboxControllerPriority SRGLetterboxControllerPriorityHigh = 750.f;
+
+/**
+ *  Default delays applied when reconnecting after a network loss (see `SRGLetterboxController (Reconnection)`).
+ */
+static const NSTimeInterval SRGLetterboxDefaultReconnectionDelay = 1.;
+static const NSTimeInterval SRGLetterboxDefaultMaximumReconnectionDelay = 30.;
+
 /**
  *  Forward declarations.
  */
@@ -569,6 +598,16 @@ static const NSTimeInterval SRGLetterboxContinuousPlaybackDisabled = DBL_MAX;
  */
 @property (nonatomic, readonly, nullable) SRGMedia *continuousPlaybackUpcomingMedia;
 
+/**
+ *  Time interval before the end of an on-demand media at which the next media is preloaded, so that continuous playback
+ *  starts without delay and its transition user interface is complete from the start. The next media metadata (including
+ *  its blocking state) and artwork are retrieved at this time, and otherwise when the transition starts.
+ *
+ *  Default is `SRGLetterboxDefaultUpcomingMediaPreloadInterval`. Set to 0 to only preload the next media when the
+ *  transition starts.
+ */
+@property (nonatomic) NSTimeInterval upcomingMediaPreloadInterval;
+
 /**
  *  Within a continuous playback transition, call this method to cancel automatic playback of the next item.
  *
@@ -713,6 +752,15 @@ static const NSTimeInterval SRGLetterboxContinuousPlaybackDisabled = DBL_MAX;
  */
 @property (nonatomic, readonly, nullable) SRGChannel *channel;
 
+/**
+ *  Set to `YES` when the available metadata has been stored during a previous session and has not been revalidated
+ *  yet (e.g. right after the application has been launched). Such metadata can be displayed, but playback only starts
+ *  once fresh metadata has been retrieved and checked for availability.
+ *
+ *  @discussion Key-value observable.
+ */
+@property (nonatomic, readonly, getter=isMetadataStale) BOOL metadataStale;
+
 /**
  *  The current subdivision being played.
  */
@@ -793,6 +841,13 @@ static const NSTimeInterval SRGLetterboxContinuousPlaybackDisabled = DBL_MAX;
  */
 @property (nonatomic, nullable) NSDictionary<NSString *, NSString *> *globalParameters;
 
+/**
+ *  Set to a value between 0 and 1 (e.g. 0.95) so that, if no media composition has been received after this percentile
+ *  of recent request latencies, a second request is sent, the first response received being used. Default is 0, which
+ *  disables duplicate requests.
+ */
+@property (nonatomic) double mediaCompositionHedgingPercentile;
+
 @end
 
 /**
@@ -843,6 +898,126 @@ static const NSTimeInterval SRGLetterboxContinuousPlaybackDisabled = DBL_MAX;
 
 @end
 
+/**
+ *  Livestream zapping. Applications can declare an ordered list of channel livestream URNs between which users can
+ *  switch (e.g. by swiping). The media compositions of the channels adjacent to the one being played are then retrieved
+ *  and kept up to date in the background, so that switching to them requires no metadata request.
+ */
+@interface SRGLetterboxController (Zapping)
+
+/**
+ *  The ordered list of channel URNs. The list is circular.
+ */
+@property (nonatomic, copy, nullable) NSArray<NSString *> *zappingURNs;
+
+/**
+ *  The channel URNs before and after the one being played. Return `nil` if the URN being played does not belong to
+ *  `zappingURNs`.
+ */
+@property (nonatomic, readonly, nullable) NSString *previousZappingURN;
+@property (nonatomic, readonly, nullable) NSString *nextZappingURN;
+
+/**
+ *  Play the previous or next channel with the current preferred settings. Return `NO` if there is no such channel.
+ */
+- (BOOL)zapToPreviousChannel;
+- (BOOL)zapToNextChannel;
+
+@end
+
+/**
+ *  Connection prewarming, reducing the time needed to start playback (e.g. at application startup, or when a media
+ *  is likely to be played soon).
+ */
+@interface SRGLetterboxController (Prewarming)
+
+/**
+ *  Resolve and connect to the hosts of the integration layer service and of the last stream played (also from a
+ *  previous application session). If a URN is provided, its media composition is retrieved as well, so that playing
+ *  it shortly afterwards with the same `standalone` setting requires no additional request.
+ *
+ *  @discussion This method is cheap and can be called repeatedly, e.g. when an item receives focus. Connections
+ *              already prewarmed recently are not opened again.
+ */
+- (void)prewarmConnectionsForURN:(nullable NSString *)URN standalone:(BOOL)standalone;
+
+@end
+
+/**
+ *  Process-wide player budget. Each controller with a prepared or playing player counts towards the budget. When the
+ *  budget is exceeded, controllers with the lowest priority (least recently active ones first for equal priorities)
+ *  are parked: their player is released, but their metadata is kept, as well as their playback position for on-demand
+ *  streams (livestreams resume at the live edge).
+ *
+ *  Parked controllers are automatically restored when promoted, either because room becomes available again or
+ *  because their priority is raised. Playback resumes if the controller was playing when parked. Calling `-play` on
+ *  a parked controller marks it as most recently active and restores it if its priority allows it.
+ *
+ *  @discussion The controller enabled for background services and controllers in picture in picture are never parked
+ *              and always take precedence over other controllers.
+ */
+@interface SRGLetterboxController (PlayerBudget)
+
+/**
+ *  The maximum number of controllers with an active player. Default is 0, which means no limit.
+ */
+@property (class, nonatomic) NSUInteger maximumActivePlayerCount;
+
+/**
+ *  The controller priority. Default is `SRGLetterboxControllerPriorityDefault`.
+ */
+@property (nonatomic) SRGLetterboxControllerPriority priority;
+
+/**
+ *  Return `YES` iff the controller has been parked to honor the player budget.
+ *
+ *  @discussion Key-value observable.
+ */
+@property (nonatomic, readonly, getter=isParked) BOOL parked;
+
+@end
+
+/**
+ *  When the network becomes reachable again, controllers which failed because of a network issue automatically retry
+ *  after a delay, so that clients do not all reach the services at the same time. The delay doubles with each
+ *  consecutive reconnection until playback succeeds, and is randomized to spread reconnections over time.
+ *
+ *  Controllers with a lower priority wait longer, so that the player the user is looking at reconnects first. The
+ *  controller enabled for background services and controllers in picture in picture are never delayed because of
+ *  their priority.
+ */
+@interface SRGLetterboxController (Reconnection)
+
+/**
+ *  The delay before the first reconnection. Default is `SRGLetterboxDefaultReconnectionDelay`. Set to 0 to reconnect
+ *  immediately.
+ */
+@property (nonatomic) NSTimeInterval reconnectionDelay;
+
+/**
+ *  The maximum delay before reconnecting. Default is `SRGLetterboxDefaultMaximumReconnectionDelay`.
+ */
+@property (nonatomic) NSTimeInterval maximumReconnectionDelay;
+
+@end
+
+/**
+ *  Resume playback where it was left off.
+ */
+@interface SRGLetterboxController (ResumePositions)
+
+/**
+ *  The store where playback positions of on-demand medias are saved, and from which they are read when playback is
+ *  started without an explicit position (also for playlist items whose data source provides no start position).
+ *  Default is `nil`, which disables position saving and restoration.
+ *
+ *  @discussion Positions are saved every few seconds during playback, as well as when playback is paused. They are
+ *              removed when playback ends.
+ */
+@property (nonatomic, nullable) SRGLetterboxPositionStore *positionStore;
+
+@end
+
 /**
  *  Settings for SRGAnalytics integration.
  */
@@ -870,6 +1045,42 @@ static const NSTimeInterval SRGLetterboxContinuousPlaybackDisabled = DBL_MAX;
 
 @end
 
+/**
+ *  Settings for updates scheduled at media start and end dates (e.g. scheduled livestreams). So that clients waiting
+ *  for the same media do not all reach the service at the same time, metadata is retrieved at a random time ahead of
+ *  the start date, while playback still starts locally at the exact start date. Similarly, playback stops exactly at
+ *  the end date, but metadata is refreshed at a random time afterwards.
+ */
+@interface SRGLetterboxController (ScheduledUpdates)
+
+/**
+ *  Minimum time interval before the start date at which metadata is retrieved. Default is
+ *  `SRGLetterboxDefaultScheduledUpdateLead`.
+ */
+@property (nonatomic) NSTimeInterval scheduledUpdateLead;
+
+/**
+ *  Duration of the window within which metadata retrieval is randomly spread, before the lead for start dates, and
+ *  after end dates. Default is `SRGLetterboxDefaultScheduledUpdateWindow`.
+ *
+ *  @discussion The lead and window sum cannot exceed `SRGLetterboxMaximumScheduledUpdateSpread`, so that retrieved
+ *              metadata is still fresh at the start date. Set both values to 0 to retrieve metadata exactly at start
+ *              and end dates.
+ */
+@property (nonatomic) NSTimeInterval scheduledUpdateWindow;
+
+/**
+ *  Time interval before the start date at which the player is prepared (paused) for media not available yet, so that
+ *  playback starts immediately at the start date. Availability information (e.g. a countdown) is still displayed
+ *  until then.
+ *
+ *  Default is 0, which disables player preparation ahead of time. Beware that a prepared player consumes network and
+ *  memory resources.
+ */
+@property (nonatomic) NSTimeInterval startDatePreparationInterval;
+
+@end
+
 /**
  *  Overriding abilities. Player functionalities might be limited when overriding has been made.
  */
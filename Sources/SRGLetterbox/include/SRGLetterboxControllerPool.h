@@ -0,0 +1,70 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGLetterboxController.h"
+#import "SRGLetterboxControllerView.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  A pool of Letterbox controllers, mostly useful for scrolling feeds where many players might be displayed. Rather than
+ *  creating a controller (and its underlying player) for each cell, cells borrow controllers from the pool when they
+ *  need one and give them back when reused. The number of controllers which can exist at the same time is capped.
+ *
+ *  @discussion Pools must be used from the main thread.
+ */
+@interface SRGLetterboxControllerPool : NSObject
+
+/**
+ *  Create a pool with the specified capacity. The optional configuration block is called when a controller is created
+ *  and each time it is returned to the pool, so that the controller always starts with the same configuration.
+ */
+- (instancetype)initWithCapacity:(NSUInteger)capacity configurationBlock:(nullable void (^)(SRGLetterboxController *controller))configurationBlock;
+
+/**
+ *  The maximum number of controllers which can exist at the same time.
+ */
+@property (nonatomic, readonly) NSUInteger capacity;
+
+/**
+ *  The number of controllers currently borrowed from the pool.
+ */
+@property (nonatomic, readonly) NSUInteger activeControllerCount;
+
+/**
+ *  Borrow a ready-to-use controller from the pool. Returns `nil` if the maximum number of controllers has been reached.
+ *
+ *  @discussion Controllers returned to the pool are used first, a new controller is only created if none is available.
+ */
+- (nullable SRGLetterboxController *)dequeueController;
+
+/**
+ *  Same as `-dequeueController`, but for a controller meant to be attached to the specified view. The controller last
+ *  used with this view is preferred if it has been returned to the pool, so that attaching it again does not rebuild
+ *  view observers from scratch. A controller still attached to some other view is detached from it first.
+ *
+ *  @discussion Controllers returned to the pool can therefore be left attached to their view until the view needs
+ *              a controller again.
+ */
+- (nullable SRGLetterboxController *)dequeueControllerForView:(nullable SRGLetterboxControllerView *)view;
+
+/**
+ *  Return a controller to the pool. Playback is reset and the configuration block is applied again. The controller must
+ *  not be used anymore afterwards.
+ *
+ *  @discussion Controllers which were not borrowed from the pool are ignored.
+ */
+- (void)recycleController:(SRGLetterboxController *)controller;
+
+@end
+
+@interface SRGLetterboxControllerPool (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
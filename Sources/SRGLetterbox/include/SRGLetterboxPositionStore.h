@@ -0,0 +1,69 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+@import CoreMedia;
+@import SRGMediaPlayer;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Persistent store of playback positions, keyed by URN, so that playback can be resumed where it was left off. Set a
+ *  store on a controller (see `SRGLetterboxController (ResumePositions)`) to have positions recorded and used to start
+ *  playback automatically.
+ *
+ *  Positions are appended in batches to a log file from a background queue, so that recording them costs almost nothing
+ *  at runtime, and so that at most a few seconds of positions are lost if the application crashes. The log is read
+ *  once (memory-mapped) when the store is first accessed, and compacted when it grows too large.
+ *
+ *  @discussion Methods can be called from any thread.
+ */
+@interface SRGLetterboxPositionStore : NSObject
+
+/**
+ *  Default store, persisted in the application support directory so that positions are not purged by the system.
+ */
+@property (class, nonatomic, readonly) SRGLetterboxPositionStore *sharedStore;
+
+/**
+ *  Create a store persisted to the specified file. Stores must not share their file.
+ */
+- (instancetype)initWithFileURL:(NSURL *)fileURL;
+
+/**
+ *  The position saved for the specified URN, `nil` if none.
+ */
+- (nullable SRGPosition *)positionForURN:(NSString *)URN;
+
+/**
+ *  Save a playback time for the specified URN. Invalid or indefinite times are ignored.
+ */
+- (void)saveTime:(CMTime)time forURN:(NSString *)URN;
+
+/**
+ *  Remove the position saved for the specified URN, if any.
+ */
+- (void)removePositionForURN:(NSString *)URN;
+
+/**
+ *  Remove all positions.
+ */
+- (void)removeAllPositions;
+
+/**
+ *  Write pending changes to disk, waiting until done. Pending changes are otherwise written automatically within a few
+ *  seconds, as well as when the application is sent to the background.
+ */
+- (void)synchronize;
+
+@end
+
+@interface SRGLetterboxPositionStore (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,132 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import <TargetConditionals.h>
+
+#if TARGET_OS_IOS
+
+#import "LetterboxBaseTestCase.h"
+
+@import OHHTTPStubs;
+@import SRGDataProviderNetwork;
+@import SRGLetterbox;
+
+@interface AutoplayManagerTestCase : LetterboxBaseTestCase
+
+@property (nonatomic) UIWindow *window;
+@property (nonatomic) UIScrollView *scrollView;
+@property (nonatomic) SRGLetterboxView *letterboxView;
+@property (nonatomic) SRGLetterboxController *controller;
+
+@property (nonatomic) SRGLetterboxAutoplayManager *autoplayManager;
+
+@property (nonatomic, weak) id<HTTPStubsDescriptor> mediaCompositionRequestStub;
+@property (nonatomic) NSInteger mediaCompositionRequestCount;
+
+@end
+
+@implementation AutoplayManagerTestCase
+
+#pragma mark Setup and tear down
+
+- (void)setUp
+{
+    self.window = [[UIWindow alloc] initWithFrame:CGRectMake(0.f, 0.f, 320.f, 480.f)];
+    
+    self.scrollView = [[UIScrollView alloc] initWithFrame:self.window.bounds];
+    self.scrollView.contentSize = CGSizeMake(320.f, 2000.f);
+    [self.window addSubview:self.scrollView];
+    
+    self.letterboxView = [[SRGLetterboxView alloc] initWithFrame:CGRectMake(0.f, 0.f, 320.f, 180.f)];
+    [self.scrollView addSubview:self.letterboxView];
+    
+    self.controller = [[SRGLetterboxController alloc] init];
+    self.letterboxView.controller = self.controller;
+    
+    self.autoplayManager = [[SRGLetterboxAutoplayManager alloc] initWithScrollView:self.scrollView maximumPlayingCount:1];
+    
+    // Slow failing media composition requests, so that scrolling happens while the media loads, then once it failed
+    self.mediaCompositionRequestStub = [HTTPStubs stubRequestsPassingTest:^BOOL(NSURLRequest *request) {
+        return [request.URL.absoluteString containsString:@"mediaComposition"] && [request.URL.absoluteString containsString:@"42844052"];
+    } withStubResponse:^HTTPStubsResponse *(NSURLRequest *request) {
+        @synchronized(self) {
+            self.mediaCompositionRequestCount += 1;
+        }
+        return [[HTTPStubsResponse responseWithData:[NSData data] statusCode:404 headers:nil] requestTime:2. responseTime:0.];
+    }];
+    self.mediaCompositionRequestStub.name = @"Slow failing media composition";
+}
+
+- (void)tearDown
+{
+    [HTTPStubs removeStub:self.mediaCompositionRequestStub];
+    
+    self.autoplayManager = nil;
+    
+    [self.controller reset];
+    self.controller = nil;
+    
+    self.window = nil;
+}
+
+#pragma mark Helpers
+
+- (SRGMedia *)media
+{
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Media retrieved"];
+    
+    __block SRGMedia *media = nil;
+    SRGDataProvider *dataProvider = [[SRGDataProvider alloc] initWithServiceURL:SRGIntegrationLayerProductionServiceURL()];
+    [[dataProvider mediasWithURNs:@[OnDemandVideoURN] completionBlock:^(NSArray<SRGMedia *> * _Nullable medias, SRGPage * _Nonnull page, SRGPage * _Nullable nextPage, NSHTTPURLResponse * _Nullable HTTPResponse, NSError * _Nullable error) {
+        media = medias.firstObject;
+        [expectation fulfill];
+    }] resume];
+    
+    [self waitForExpectationsWithTimeout:20. handler:nil];
+    
+    XCTAssertNotNil(media);
+    return media;
+}
+
+- (void)scroll
+{
+    for (NSInteger i = 0; i < 20; ++i) {
+        self.scrollView.contentOffset = CGPointMake(0.f, i);
+    }
+}
+
+#pragma mark Tests
+
+- (void)testScrollingWhileLoading
+{
+    SRGMedia *media = [self media];
+    
+    [self.autoplayManager registerLetterboxView:self.letterboxView withMedia:media preferredSettings:nil];
+    [self scroll];
+    
+    XCTAssertEqualObjects(self.controller.URN, OnDemandVideoURN);
+    XCTAssertTrue(self.controller.loading);
+    
+    [self expectationForSingleNotification:SRGLetterboxPlaybackDidFailNotification object:self.controller handler:nil];
+    
+    [self waitForExpectationsWithTimeout:20. handler:nil];
+    
+    // Scrolling after failure must not load the media again either
+    [self scroll];
+    
+    [self expectationForElapsedTimeInterval:3. withHandler:nil];
+    
+    [self waitForExpectationsWithTimeout:20. handler:nil];
+    
+    XCTAssertNotNil(self.controller.error);
+    @synchronized(self) {
+        XCTAssertEqual(self.mediaCompositionRequestCount, 1);
+    }
+}
+
+@end
+
+#endif
@@ -0,0 +1,150 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "LetterboxBaseTestCase.h"
+
+@import SRGLetterbox;
+
+// Count attachments, overriding `SRGLetterboxControllerView` subclassing hooks
+@interface AttachmentCountingView : SRGLetterboxControllerView
+
+@property (nonatomic) NSInteger attachmentCount;
+@property (nonatomic) NSInteger reattachmentCount;
+
+@end
+
+@interface ControllerPoolTestCase : LetterboxBaseTestCase
+
+@end
+
+@implementation ControllerPoolTestCase
+
+#pragma mark Tests
+
+- (void)testCapacity
+{
+    SRGLetterboxControllerPool *pool = [[SRGLetterboxControllerPool alloc] initWithCapacity:2 configurationBlock:nil];
+    XCTAssertEqual(pool.capacity, 2);
+    XCTAssertEqual(pool.activeControllerCount, 0);
+    
+    SRGLetterboxController *controller1 = [pool dequeueController];
+    XCTAssertNotNil(controller1);
+    
+    SRGLetterboxController *controller2 = [pool dequeueController];
+    XCTAssertNotNil(controller2);
+    XCTAssertNotEqual(controller1, controller2);
+    XCTAssertEqual(pool.activeControllerCount, 2);
+    
+    XCTAssertNil([pool dequeueController]);
+    
+    [pool recycleController:controller1];
+    XCTAssertEqual(pool.activeControllerCount, 1);
+}
+
+- (void)testReuse
+{
+    SRGLetterboxControllerPool *pool = [[SRGLetterboxControllerPool alloc] initWithCapacity:1 configurationBlock:nil];
+    
+    SRGLetterboxController *controller = [pool dequeueController];
+    [pool recycleController:controller];
+    XCTAssertEqual([pool dequeueController], controller);
+}
+
+- (void)testConfiguration
+{
+    SRGLetterboxControllerPool *pool = [[SRGLetterboxControllerPool alloc] initWithCapacity:1 configurationBlock:^(SRGLetterboxController * _Nonnull controller) {
+        controller.muted = YES;
+    }];
+    
+    SRGLetterboxController *controller = [pool dequeueController];
+    XCTAssertTrue(controller.muted);
+    
+    controller.muted = NO;
+    [pool recycleController:controller];
+    
+    XCTAssertTrue([pool dequeueController].muted);
+}
+
+- (void)testRecycleForeignController
+{
+    SRGLetterboxControllerPool *pool = [[SRGLetterboxControllerPool alloc] initWithCapacity:1 configurationBlock:nil];
+    
+    SRGLetterboxController *controller = [[SRGLetterboxController alloc] init];
+    [pool recycleController:controller];
+    XCTAssertNotEqual([pool dequeueController], controller);
+}
+
+- (void)testViewAffinity
+{
+    SRGLetterboxControllerPool *pool = [[SRGLetterboxControllerPool alloc] initWithCapacity:2 configurationBlock:nil];
+    
+    AttachmentCountingView *view1 = [[AttachmentCountingView alloc] init];
+    AttachmentCountingView *view2 = [[AttachmentCountingView alloc] init];
+    
+    SRGLetterboxController *controller1 = [pool dequeueControllerForView:view1];
+    view1.controller = controller1;
+    
+    SRGLetterboxController *controller2 = [pool dequeueControllerForView:view2];
+    view2.controller = controller2;
+    
+    XCTAssertEqual(view1.attachmentCount, 1);
+    XCTAssertEqual(view2.attachmentCount, 1);
+    
+    // Recycle both controllers, leaving them attached to their views. Each view gets its previous controller back.
+    [pool recycleController:controller1];
+    [pool recycleController:controller2];
+    
+    XCTAssertEqual([pool dequeueControllerForView:view1], controller1);
+    view1.controller = controller1;
+    
+    XCTAssertEqual([pool dequeueControllerForView:view2], controller2);
+    view2.controller = controller2;
+    
+    XCTAssertEqual(view1.attachmentCount, 1);
+    XCTAssertEqual(view1.reattachmentCount, 1);
+    XCTAssertEqual(view2.attachmentCount, 1);
+    XCTAssertEqual(view2.reattachmentCount, 1);
+}
+
+- (void)testControllerDetachedFromPreviousView
+{
+    SRGLetterboxControllerPool *pool = [[SRGLetterboxControllerPool alloc] initWithCapacity:1 configurationBlock:nil];
+    
+    AttachmentCountingView *view1 = [[AttachmentCountingView alloc] init];
+    AttachmentCountingView *view2 = [[AttachmentCountingView alloc] init];
+    
+    SRGLetterboxController *controller = [pool dequeueControllerForView:view1];
+    view1.controller = controller;
+    [pool recycleController:controller];
+    
+    // The only available controller is moved to the other view
+    XCTAssertEqual([pool dequeueControllerForView:view2], controller);
+    XCTAssertNil(view1.controller);
+    
+    view2.controller = controller;
+    XCTAssertEqual(view2.attachmentCount, 1);
+    XCTAssertEqual(view2.reattachmentCount, 0);
+}
+
+@end
+
+@implementation AttachmentCountingView
+
+- (void)didAttachToController
+{
+    [super didAttachToController];
+    
+    self.attachmentCount += 1;
+}
+
+- (void)didReattachToController
+{
+    [super didReattachToController];
+    
+    self.reattachmentCount += 1;
+}
+
+@end
@@ -0,0 +1,197 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "LetterboxBaseTestCase.h"
+
+@import OHHTTPStubs;
+@import SRGDataProviderNetwork;
+@import SRGLetterbox;
+
+// Imports required to test internals
+#import "SRGLetterboxHedgedMediaCompositionRequest.h"
+
+@interface HedgedMediaCompositionRequestTestCase : LetterboxBaseTestCase
+
+@property (nonatomic) SRGDataProvider *dataProvider;
+@property (nonatomic) SRGRequestQueue *requestQueue;
+
+@property (nonatomic, weak) id<HTTPStubsDescriptor> mediaCompositionRequestStub;
+@property (nonatomic) NSInteger mediaCompositionRequestCount;
+
+@end
+
+@implementation HedgedMediaCompositionRequestTestCase
+
+#pragma mark Setup and tear down
+
+- (void)setUp
+{
+    [SRGLetterboxHedgedMediaCompositionRequest removeAllLatencies];
+    
+    self.dataProvider = [[SRGDataProvider alloc] initWithServiceURL:SRGIntegrationLayerProductionServiceURL()];
+    self.requestQueue = [[SRGRequestQueue alloc] init];
+    
+    // Slow responses, so that hedging has a chance to occur
+    self.mediaCompositionRequestStub = [HTTPStubs stubRequestsPassingTest:^BOOL(NSURLRequest *request) {
+        return [request.URL.absoluteString containsString:@"mediaComposition"];
+    } withStubResponse:^HTTPStubsResponse *(NSURLRequest *request) {
+        @synchronized(self) {
+            self.mediaCompositionRequestCount += 1;
+        }
+        return [[HTTPStubsResponse responseWithData:[NSData data] statusCode:404 headers:nil] requestTime:1. responseTime:0.];
+    }];
+    self.mediaCompositionRequestStub.name = @"Slow media composition";
+}
+
+- (void)tearDown
+{
+    [HTTPStubs removeStub:self.mediaCompositionRequestStub];
+    
+    [self.requestQueue cancel];
+    self.requestQueue = nil;
+    
+    [SRGLetterboxHedgedMediaCompositionRequest removeAllLatencies];
+}
+
+#pragma mark Helpers
+
+- (void)recordLatencies:(NSTimeInterval)latency count:(NSUInteger)count
+{
+    for (NSUInteger i = 0; i < count; ++i) {
+        [SRGLetterboxHedgedMediaCompositionRequest recordLatency:latency];
+    }
+}
+
+// Run a request with the specified hedging percentile, returning the number of underlying requests which were sent
+- (NSInteger)requestCountWithHedgingPercentile:(double)hedgingPercentile
+{
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Request completed"];
+    
+    __block NSInteger completionCount = 0;
+    SRGLetterboxHedgedMediaCompositionRequest *request = [[SRGLetterboxHedgedMediaCompositionRequest alloc] initWithURN:OnDemandVideoURN standalone:NO dataProvider:self.dataProvider hedgingPercentile:hedgingPercentile completionBlock:^(SRGMediaComposition * _Nullable mediaComposition, NSHTTPURLResponse * _Nullable HTTPResponse, NSError * _Nullable error) {
+        completionCount += 1;
+        [expectation fulfill];
+    }];
+    [request resumeInRequestQueue:self.requestQueue];
+    
+    [self waitForExpectationsWithTimeout:10. handler:nil];
+    
+    // Ensure the completion block is called only once
+    [self expectationForElapsedTimeInterval:2. withHandler:nil];
+    
+    [self waitForExpectationsWithTimeout:10. handler:nil];
+    
+    XCTAssertEqual(completionCount, 1);
+    
+    @synchronized(self) {
+        return self.mediaCompositionRequestCount;
+    }
+}
+
+#pragma mark Tests
+
+- (void)testLatencyPercentiles
+{
+    [self recordLatencies:1. count:9];
+    XCTAssertEqual([SRGLetterboxHedgedMediaCompositionRequest latencyForPercentile:0.9], 0.);
+    
+    [self recordLatencies:2. count:1];
+    XCTAssertEqual([SRGLetterboxHedgedMediaCompositionRequest latencyForPercentile:0.9], 1.);
+    XCTAssertEqual([SRGLetterboxHedgedMediaCompositionRequest latencyForPercentile:1.], 2.);
+    XCTAssertEqual([SRGLetterboxHedgedMediaCompositionRequest latencyForPercentile:0.], 1.);
+    
+    // Only the most recent latencies are kept
+    [self recordLatencies:3. count:50];
+    XCTAssertEqual([SRGLetterboxHedgedMediaCompositionRequest latencyForPercentile:0.], 3.);
+}
+
+- (void)testNoHedgingWithoutEnoughLatencies
+{
+    [self recordLatencies:0.2 count:9];
+    XCTAssertEqual([self requestCountWithHedgingPercentile:0.9], 1);
+}
+
+- (void)testNoHedgingWhenDisabled
+{
+    [self recordLatencies:0.2 count:50];
+    XCTAssertEqual([self requestCountWithHedgingPercentile:0.], 1);
+}
+
+- (void)testHedging
+{
+    [self recordLatencies:0.2 count:50];
+    XCTAssertEqual([self requestCountWithHedgingPercentile:0.9], 2);
+}
+
+- (void)testNoHedgingForFastRequests
+{
+    [self recordLatencies:5. count:50];
+    XCTAssertEqual([self requestCountWithHedgingPercentile:0.9], 1);
+}
+
+- (void)testTransientFailureWhileHedging
+{
+    [self recordLatencies:0.2 count:50];
+    
+    // The first request fails with a transient error while the second one is still running
+    __block NSInteger requestCount = 0;
+    id<HTTPStubsDescriptor> mediaCompositionRequestStub = [HTTPStubs stubRequestsPassingTest:^BOOL(NSURLRequest *request) {
+        return [request.URL.absoluteString containsString:@"mediaComposition"];
+    } withStubResponse:^HTTPStubsResponse *(NSURLRequest *request) {
+        NSInteger count = 0;
+        @synchronized(self) {
+            count = ++requestCount;
+        }
+        if (count == 1) {
+            return [[HTTPStubsResponse responseWithError:[NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorNetworkConnectionLost userInfo:nil]] requestTime:0.5 responseTime:0.];
+        }
+        else {
+            return [[HTTPStubsResponse responseWithData:[NSData data] statusCode:404 headers:nil] requestTime:1.5 responseTime:0.];
+        }
+    }];
+    mediaCompositionRequestStub.name = @"Transient failure, then slow response";
+    
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Request completed"];
+    
+    __block NSHTTPURLResponse *receivedHTTPResponse = nil;
+    SRGLetterboxHedgedMediaCompositionRequest *request = [[SRGLetterboxHedgedMediaCompositionRequest alloc] initWithURN:OnDemandVideoURN standalone:NO dataProvider:self.dataProvider hedgingPercentile:0.9 completionBlock:^(SRGMediaComposition * _Nullable mediaComposition, NSHTTPURLResponse * _Nullable HTTPResponse, NSError * _Nullable error) {
+        receivedHTTPResponse = HTTPResponse;
+        [expectation fulfill];
+    }];
+    [request resumeInRequestQueue:self.requestQueue];
+    
+    [self waitForExpectationsWithTimeout:10. handler:^(NSError * _Nullable error) {
+        [HTTPStubs removeStub:mediaCompositionRequestStub];
+    }];
+    
+    // The response of the second request is received
+    XCTAssertEqual(receivedHTTPResponse.statusCode, 404);
+    @synchronized(self) {
+        XCTAssertEqual(requestCount, 2);
+    }
+}
+
+- (void)testCancellation
+{
+    [self recordLatencies:0.2 count:50];
+    
+    SRGLetterboxHedgedMediaCompositionRequest *request = [[SRGLetterboxHedgedMediaCompositionRequest alloc] initWithURN:OnDemandVideoURN standalone:NO dataProvider:self.dataProvider hedgingPercentile:0.9 completionBlock:^(SRGMediaComposition * _Nullable mediaComposition, NSHTTPURLResponse * _Nullable HTTPResponse, NSError * _Nullable error) {
+        XCTFail(@"Completion block must not be called when the request has been cancelled");
+    }];
+    [request resumeInRequestQueue:self.requestQueue];
+    [request cancel];
+    
+    // No duplicate request must be sent after cancellation
+    [self expectationForElapsedTimeInterval:3. withHandler:nil];
+    
+    [self waitForExpectationsWithTimeout:10. handler:nil];
+    
+    @synchronized(self) {
+        XCTAssertLessThanOrEqual(self.mediaCompositionRequestCount, 1);
+    }
+}
+
+@end
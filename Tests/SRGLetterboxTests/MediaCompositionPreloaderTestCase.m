@@ -0,0 +1,92 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "LetterboxBaseTestCase.h"
+
+@import OHHTTPStubs;
+@import SRGDataProviderNetwork;
+@import SRGLetterbox;
+
+// Imports required to test internals
+#import "SRGLetterboxMediaCompositionPreloader.h"
+
+@interface MediaCompositionPreloaderTestCase : LetterboxBaseTestCase
+
+@property (nonatomic) SRGDataProvider *dataProvider;
+
+@end
+
+@implementation MediaCompositionPreloaderTestCase
+
+#pragma mark Setup and tear down
+
+- (void)setUp
+{
+    self.dataProvider = [[SRGDataProvider alloc] initWithServiceURL:SRGIntegrationLayerProductionServiceURL()];
+}
+
+- (void)tearDown
+{
+    [HTTPStubs removeAllStubs];
+    self.dataProvider = nil;
+}
+
+#pragma mark Helpers
+
+- (void)waitForTimeInterval:(NSTimeInterval)timeInterval
+{
+    [self expectationForElapsedTimeInterval:timeInterval withHandler:nil];
+    
+    [self waitForExpectationsWithTimeout:timeInterval + 10. handler:nil];
+}
+
+#pragma mark Tests
+
+- (void)testPreloading
+{
+    SRGLetterboxMediaCompositionPreloader *preloader = [[SRGLetterboxMediaCompositionPreloader alloc] initWithMaximumAge:60.];
+    XCTAssertNil([preloader mediaCompositionForURN:OnDemandVideoURN standalone:NO]);
+    
+    [preloader preloadMediaCompositionForURN:OnDemandVideoURN standalone:NO withDataProvider:self.dataProvider];
+    [self waitForTimeInterval:3.];
+    
+    XCTAssertEqualObjects([preloader mediaCompositionForURN:OnDemandVideoURN standalone:NO].chapterURN, OnDemandVideoURN);
+    XCTAssertNil([preloader mediaCompositionForURN:OnDemandVideoURN standalone:YES]);
+    
+    [preloader removeAllMediaCompositions];
+    XCTAssertNil([preloader mediaCompositionForURN:OnDemandVideoURN standalone:NO]);
+}
+
+- (void)testExpiryAfterFailedRefresh
+{
+    SRGLetterboxMediaCompositionPreloader *preloader = [[SRGLetterboxMediaCompositionPreloader alloc] initWithMaximumAge:6.];
+    
+    [preloader preloadMediaCompositionForURN:OnDemandVideoURN standalone:NO withDataProvider:self.dataProvider];
+    [self waitForTimeInterval:2.];
+    
+    XCTAssertNotNil([preloader mediaCompositionForURN:OnDemandVideoURN standalone:NO]);
+    
+    id<HTTPStubsDescriptor> mediaCompositionRequestStub = [HTTPStubs stubRequestsPassingTest:^BOOL(NSURLRequest *request) {
+        return [request.URL.absoluteString containsString:@"mediaComposition"];
+    } withStubResponse:^HTTPStubsResponse *(NSURLRequest *request) {
+        return [HTTPStubsResponse responseWithError:[NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorNotConnectedToInternet userInfo:nil]];
+    }];
+    mediaCompositionRequestStub.name = @"Unavailable media composition";
+    
+    // Refresh fails. The previous media composition is kept, but expires as if no refresh had been attempted
+    [self waitForTimeInterval:2.5];
+    
+    [preloader preloadMediaCompositionForURN:OnDemandVideoURN standalone:NO withDataProvider:self.dataProvider];
+    [self waitForTimeInterval:0.5];
+    
+    XCTAssertNotNil([preloader mediaCompositionForURN:OnDemandVideoURN standalone:NO]);
+    
+    [self waitForTimeInterval:3.5];
+    
+    XCTAssertNil([preloader mediaCompositionForURN:OnDemandVideoURN standalone:NO]);
+}
+
+@end
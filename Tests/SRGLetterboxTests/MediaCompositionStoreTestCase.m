@@ -0,0 +1,190 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "LetterboxBaseTestCase.h"
+
+@import SRGDataProviderNetwork;
+@import SRGLetterbox;
+
+// Imports required to test internals
+#import "SRGLetterboxMediaCompositionStore.h"
+
+static const NSUInteger kCapacity = 20;
+static const NSTimeInterval kMaximumAge = 7. * 24. * 60. * 60.;
+
+static NSString *TestURN(NSUInteger index)
+{
+    return [NSString stringWithFormat:@"urn:test:video:%@", @(index)];
+}
+
+@interface MediaCompositionStoreTestCase : LetterboxBaseTestCase
+
+@property (nonatomic) NSURL *directoryURL;
+@property (nonatomic) NSURL *fileURL;
+
+@property (nonatomic) SRGMediaComposition *mediaComposition;
+
+@end
+
+@implementation MediaCompositionStoreTestCase
+
+#pragma mark Setup and tear down
+
+- (void)setUp
+{
+    self.directoryURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:NSUUID.UUID.UUIDString]];
+    self.fileURL = [SRGLetterboxMediaCompositionStore fileURLInDirectoryAtURL:self.directoryURL];
+    
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Media composition retrieved"];
+    
+    SRGDataProvider *dataProvider = [[SRGDataProvider alloc] initWithServiceURL:SRGIntegrationLayerProductionServiceURL()];
+    [[dataProvider mediaCompositionForURN:OnDemandVideoURN standalone:NO withCompletionBlock:^(SRGMediaComposition * _Nullable mediaComposition, NSHTTPURLResponse * _Nullable HTTPResponse, NSError * _Nullable error) {
+        self.mediaComposition = mediaComposition;
+        [expectation fulfill];
+    }] resume];
+    
+    [self waitForExpectationsWithTimeout:20. handler:nil];
+    
+    XCTAssertNotNil(self.mediaComposition);
+}
+
+- (void)tearDown
+{
+    [NSFileManager.defaultManager removeItemAtURL:self.directoryURL error:NULL];
+    self.directoryURL = nil;
+    self.fileURL = nil;
+    
+    self.mediaComposition = nil;
+}
+
+#pragma mark Tests
+
+- (void)testStoreAndRemove
+{
+    SRGLetterboxMediaCompositionStore *store = [[SRGLetterboxMediaCompositionStore alloc] initWithFileURL:self.fileURL capacity:kCapacity maximumAge:kMaximumAge];
+    XCTAssertNil([store mediaCompositionForURN:OnDemandVideoURN standalone:NO]);
+    
+    [store storeMediaComposition:self.mediaComposition forURN:OnDemandVideoURN standalone:NO];
+    XCTAssertEqualObjects([store mediaCompositionForURN:OnDemandVideoURN standalone:NO], self.mediaComposition);
+    XCTAssertNil([store mediaCompositionForURN:OnDemandVideoURN standalone:YES]);
+    
+    [store removeAllMediaCompositions];
+    XCTAssertNil([store mediaCompositionForURN:OnDemandVideoURN standalone:NO]);
+}
+
+- (void)testPersistence
+{
+    SRGLetterboxMediaCompositionStore *store1 = [[SRGLetterboxMediaCompositionStore alloc] initWithFileURL:self.fileURL capacity:kCapacity maximumAge:kMaximumAge];
+    [store1 storeMediaComposition:self.mediaComposition forURN:OnDemandVideoURN standalone:NO];
+    [store1 storeMediaComposition:self.mediaComposition forURN:OnDemandVideoURN standalone:YES];
+    [store1 synchronize];
+    
+    SRGLetterboxMediaCompositionStore *store2 = [[SRGLetterboxMediaCompositionStore alloc] initWithFileURL:self.fileURL capacity:kCapacity maximumAge:kMaximumAge];
+    SRGMediaComposition *mediaComposition = [store2 mediaCompositionForURN:OnDemandVideoURN standalone:NO];
+    XCTAssertEqualObjects(mediaComposition, self.mediaComposition);
+    XCTAssertEqualObjects(mediaComposition.chapterURN, OnDemandVideoURN);
+    XCTAssertNotNil(mediaComposition.mainChapter.resources.firstObject.URL);
+    XCTAssertEqualObjects([store2 mediaCompositionForURN:OnDemandVideoURN standalone:YES], self.mediaComposition);
+    
+    [store2 removeAllMediaCompositions];
+    [store2 synchronize];
+    
+    SRGLetterboxMediaCompositionStore *store3 = [[SRGLetterboxMediaCompositionStore alloc] initWithFileURL:self.fileURL capacity:kCapacity maximumAge:kMaximumAge];
+    XCTAssertNil([store3 mediaCompositionForURN:OnDemandVideoURN standalone:NO]);
+    XCTAssertNil([store3 mediaCompositionForURN:OnDemandVideoURN standalone:YES]);
+}
+
+- (void)testEviction
+{
+    SRGLetterboxMediaCompositionStore *store1 = [[SRGLetterboxMediaCompositionStore alloc] initWithFileURL:self.fileURL capacity:kCapacity maximumAge:kMaximumAge];
+    for (NSUInteger i = 0; i < kCapacity; ++i) {
+        [store1 storeMediaComposition:self.mediaComposition forURN:TestURN(i) standalone:NO];
+    }
+    
+    // Storing the oldest entry again makes it the most recently used one
+    [store1 storeMediaComposition:self.mediaComposition forURN:TestURN(0) standalone:NO];
+    [store1 storeMediaComposition:self.mediaComposition forURN:TestURN(kCapacity) standalone:NO];
+    
+    XCTAssertNotNil([store1 mediaCompositionForURN:TestURN(0) standalone:NO]);
+    XCTAssertNil([store1 mediaCompositionForURN:TestURN(1) standalone:NO]);
+    for (NSUInteger i = 2; i <= kCapacity; ++i) {
+        XCTAssertNotNil([store1 mediaCompositionForURN:TestURN(i) standalone:NO]);
+    }
+    [store1 synchronize];
+    
+    SRGLetterboxMediaCompositionStore *store2 = [[SRGLetterboxMediaCompositionStore alloc] initWithFileURL:self.fileURL capacity:kCapacity maximumAge:kMaximumAge];
+    XCTAssertNotNil([store2 mediaCompositionForURN:TestURN(0) standalone:NO]);
+    XCTAssertNil([store2 mediaCompositionForURN:TestURN(1) standalone:NO]);
+    XCTAssertNotNil([store2 mediaCompositionForURN:TestURN(kCapacity) standalone:NO]);
+}
+
+- (void)testExpiry
+{
+    SRGLetterboxMediaCompositionStore *store1 = [[SRGLetterboxMediaCompositionStore alloc] initWithFileURL:self.fileURL capacity:kCapacity maximumAge:1.];
+    [store1 storeMediaComposition:self.mediaComposition forURN:OnDemandVideoURN standalone:NO];
+    XCTAssertNotNil([store1 mediaCompositionForURN:OnDemandVideoURN standalone:NO]);
+    [store1 synchronize];
+    
+    [self expectationForElapsedTimeInterval:2. withHandler:nil];
+    
+    [self waitForExpectationsWithTimeout:10. handler:nil];
+    
+    XCTAssertNil([store1 mediaCompositionForURN:OnDemandVideoURN standalone:NO]);
+    
+    // Expired entries are discarded when read from disk
+    SRGLetterboxMediaCompositionStore *store2 = [[SRGLetterboxMediaCompositionStore alloc] initWithFileURL:self.fileURL capacity:kCapacity maximumAge:1.];
+    XCTAssertNil([store2 mediaCompositionForURN:OnDemandVideoURN standalone:NO]);
+    
+    // Entries are still available with a longer maximum age
+    SRGLetterboxMediaCompositionStore *store3 = [[SRGLetterboxMediaCompositionStore alloc] initWithFileURL:self.fileURL capacity:kCapacity maximumAge:kMaximumAge];
+    XCTAssertNotNil([store3 mediaCompositionForURN:OnDemandVideoURN standalone:NO]);
+}
+
+- (void)testFilesFromOtherVersionsRemoval
+{
+    [@"data" writeToURL:self.fileURL atomically:YES encoding:NSUTF8StringEncoding error:NULL];
+    
+    NSURL *otherVersionFileURL = [self.directoryURL URLByAppendingPathComponent:@"v0-1.0.0"];
+    [@"data" writeToURL:otherVersionFileURL atomically:YES encoding:NSUTF8StringEncoding error:NULL];
+    XCTAssertTrue([NSFileManager.defaultManager fileExistsAtPath:otherVersionFileURL.path]);
+    
+    XCTAssertEqualObjects([SRGLetterboxMediaCompositionStore fileURLInDirectoryAtURL:self.directoryURL], self.fileURL);
+    XCTAssertFalse([NSFileManager.defaultManager fileExistsAtPath:otherVersionFileURL.path]);
+    XCTAssertTrue([NSFileManager.defaultManager fileExistsAtPath:self.fileURL.path]);
+}
+
+- (void)testCorruptArchive
+{
+    [@"corrupt" writeToURL:self.fileURL atomically:YES encoding:NSUTF8StringEncoding error:NULL];
+    
+    SRGLetterboxMediaCompositionStore *store1 = [[SRGLetterboxMediaCompositionStore alloc] initWithFileURL:self.fileURL capacity:kCapacity maximumAge:kMaximumAge];
+    XCTAssertNil([store1 mediaCompositionForURN:OnDemandVideoURN standalone:NO]);
+    XCTAssertFalse([NSFileManager.defaultManager fileExistsAtPath:self.fileURL.path]);
+    
+    // The store is usable again afterwards
+    [store1 storeMediaComposition:self.mediaComposition forURN:OnDemandVideoURN standalone:NO];
+    [store1 synchronize];
+    
+    SRGLetterboxMediaCompositionStore *store2 = [[SRGLetterboxMediaCompositionStore alloc] initWithFileURL:self.fileURL capacity:kCapacity maximumAge:kMaximumAge];
+    XCTAssertEqualObjects([store2 mediaCompositionForURN:OnDemandVideoURN standalone:NO], self.mediaComposition);
+}
+
+- (void)testUnexpectedClassesInArchive
+{
+    // Archives are decoded securely, and only model classes are accepted
+    NSDictionary *archive = @{ @"keys" : @[ @"key" ],
+                               @"mediaCompositions" : @{ @"key" : NSUUID.UUID },
+                               @"dates" : @{ @"key" : NSDate.date } };
+    NSData *data = [NSKeyedArchiver archivedDataWithRootObject:archive requiringSecureCoding:YES error:NULL];
+    XCTAssertNotNil(data);
+    [data writeToURL:self.fileURL atomically:YES];
+    
+    SRGLetterboxMediaCompositionStore *store = [[SRGLetterboxMediaCompositionStore alloc] initWithFileURL:self.fileURL capacity:kCapacity maximumAge:kMaximumAge];
+    XCTAssertNil([store mediaCompositionForURN:@"key" standalone:NO]);
+    XCTAssertFalse([NSFileManager.defaultManager fileExistsAtPath:self.fileURL.path]);
+}
+
+@end
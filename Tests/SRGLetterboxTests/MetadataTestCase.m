@@ -195,4 +195,46 @@
     XCTAssertNil([self.controller displayableSubdivisionAtTime:kCMTimeZero]);
 }
 
+- (void)testStaleMetadataUntilRevalidated
+{
+    // Play the media once so that its media composition gets stored
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    NSString *URN = OnDemandVideoURN;
+    [self.controller playURN:URN atPosition:nil withPreferredSettings:nil];
+    
+    [self waitForExpectationsWithTimeout:20. handler:nil];
+    
+    XCTAssertFalse(self.controller.metadataStale);
+    
+    [self.controller reset];
+    
+    // Use another controller so that no preloaded media composition is available
+    SRGLetterboxController *controller = [[SRGLetterboxController alloc] init];
+    
+    __block BOOL initialMetadataStale = NO;
+    [self expectationForSingleNotification:SRGLetterboxMetadataDidChangeNotification object:controller handler:^BOOL(NSNotification * _Nonnull notification) {
+        if (! notification.userInfo[SRGLetterboxMediaCompositionKey]) {
+            return NO;
+        }
+        initialMetadataStale = controller.metadataStale;
+        return YES;
+    }];
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:controller handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [controller playURN:URN atPosition:nil withPreferredSettings:nil];
+    
+    [self waitForExpectationsWithTimeout:20. handler:nil];
+    
+    XCTAssertTrue(initialMetadataStale);
+    XCTAssertFalse(controller.metadataStale);
+    XCTAssertEqualObjects(controller.mediaComposition.chapterURN, URN);
+    
+    [controller reset];
+}
+
 @end
@@ -1253,6 +1253,53 @@
     XCTAssertNil(self.controller.error);
 }
 
+- (void)testPlayBeforeStartDateWithPreparedPlayer
+{
+    self.controller.serviceURL = MMFServiceURL();
+    self.controller.startDatePreparationInterval = 10.;
+    
+    NSDate *startDate = [NSDate dateWithTimeIntervalSinceNow:10];
+    NSDate *endDate = [startDate dateByAddingTimeInterval:20];
+    NSString *URN = MMFScheduledOnDemandVideoURN(startDate, endDate);
+    
+    // The player is prepared (paused) ahead of the start date
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePaused;
+    }];
+    
+    [self.controller playURN:URN atPosition:nil withPreferredSettings:nil];
+    
+    [self waitForExpectationsWithTimeout:20. handler:nil];
+    
+    XCTAssertEqual([self.controller.error.userInfo[SRGLetterboxBlockingReasonKey] integerValue], SRGBlockingReasonStartDate);
+    
+    // Playing before the start date must have no effect
+    id eventObserver = [NSNotificationCenter.defaultCenter addObserverForName:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller queue:nil usingBlock:^(NSNotification * _Nonnull notification) {
+        XCTFail(@"Playback must not start before the start date.");
+    }];
+    
+    [self expectationForElapsedTimeInterval:2. withHandler:nil];
+    
+    [self.controller play];
+    
+    [self waitForExpectationsWithTimeout:20. handler:^(NSError * _Nullable error) {
+        [NSNotificationCenter.defaultCenter removeObserver:eventObserver];
+    }];
+    
+    XCTAssertEqual(self.controller.playbackState, SRGMediaPlayerPlaybackStatePaused);
+    XCTAssertNotNil(self.controller.error);
+    
+    // Playback starts at the start date
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [self waitForExpectationsWithTimeout:30. handler:nil];
+    
+    XCTAssertEqual([self.controller.media blockingReasonAtDate:NSDate.date], SRGBlockingReasonNone);
+    XCTAssertNil(self.controller.error);
+}
+
 - (void)testMediaWithOverriddenURLNotYetAvailable
 {
     self.controller.serviceURL = MMFServiceURL();
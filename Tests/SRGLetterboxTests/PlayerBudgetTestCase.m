@@ -0,0 +1,184 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "LetterboxBaseTestCase.h"
+
+@import SRGLetterbox;
+
+// Internals required for testing
+@interface SRGLetterboxController (PlayerBudgetTestCase)
+
+@property (nonatomic, readonly) SRGPosition *startPosition;
+
+@end
+
+@interface PlayerBudgetTestCase : LetterboxBaseTestCase
+
+@property (nonatomic) SRGLetterboxController *controller1;
+@property (nonatomic) SRGLetterboxController *controller2;
+
+@end
+
+@implementation PlayerBudgetTestCase
+
+#pragma mark Setup and tear down
+
+- (void)setUp
+{
+    self.controller1 = [[SRGLetterboxController alloc] init];
+    self.controller2 = [[SRGLetterboxController alloc] init];
+}
+
+- (void)tearDown
+{
+    SRGLetterboxController.maximumActivePlayerCount = 0;
+    
+    [self.controller1 reset];
+    self.controller1 = nil;
+    
+    [self.controller2 reset];
+    self.controller2 = nil;
+}
+
+#pragma mark Tests
+
+- (void)testDefaultValues
+{
+    XCTAssertEqual(SRGLetterboxController.maximumActivePlayerCount, 0);
+    XCTAssertEqual(self.controller1.priority, SRGLetterboxControllerPriorityDefault);
+    XCTAssertFalse(self.controller1.parked);
+}
+
+- (void)testUnlimitedBudget
+{
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller1 handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller2 handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [self.controller1 playURN:OnDemandVideoURN atPosition:nil withPreferredSettings:nil];
+    [self.controller2 playURN:OnDemandLongVideoURN atPosition:nil withPreferredSettings:nil];
+    
+    [self waitForExpectationsWithTimeout:30. handler:nil];
+    
+    XCTAssertFalse(self.controller1.parked);
+    XCTAssertFalse(self.controller2.parked);
+}
+
+- (void)testLowestPriorityParking
+{
+    SRGLetterboxController.maximumActivePlayerCount = 1;
+    
+    self.controller2.priority = SRGLetterboxControllerPriorityHigh;
+    
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller1 handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [self.controller1 playURN:OnDemandVideoURN atPosition:nil withPreferredSettings:nil];
+    
+    [self waitForExpectationsWithTimeout:30. handler:nil];
+    
+    [self keyValueObservingExpectationForObject:self.controller1 keyPath:@"parked" expectedValue:@YES];
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller2 handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [self.controller2 playURN:OnDemandLongVideoURN atPosition:nil withPreferredSettings:nil];
+    
+    [self waitForExpectationsWithTimeout:30. handler:nil];
+    
+    // Metadata is kept while parked
+    XCTAssertEqual(self.controller1.playbackState, SRGMediaPlayerPlaybackStateIdle);
+    XCTAssertEqualObjects(self.controller1.URN, OnDemandVideoURN);
+    XCTAssertNotNil(self.controller1.mediaComposition);
+    XCTAssertFalse(self.controller2.parked);
+    
+    // Playback resumes when room is available again
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller1 handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [self.controller2 reset];
+    
+    [self waitForExpectationsWithTimeout:30. handler:nil];
+    
+    XCTAssertFalse(self.controller1.parked);
+}
+
+- (void)testStartPositionKeptAfterParking
+{
+    SRGLetterboxController.maximumActivePlayerCount = 1;
+    
+    self.controller2.priority = SRGLetterboxControllerPriorityHigh;
+    
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller1 handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [self.controller1 playURN:OnDemandLongVideoURN atPosition:[SRGPosition positionAtTimeInSeconds:30.] withPreferredSettings:nil];
+    
+    [self waitForExpectationsWithTimeout:30. handler:nil];
+    
+    [self expectationForElapsedTimeInterval:3. withHandler:nil];
+    
+    [self waitForExpectationsWithTimeout:30. handler:nil];
+    
+    [self keyValueObservingExpectationForObject:self.controller1 keyPath:@"parked" expectedValue:@YES];
+    
+    [self.controller2 playURN:OnDemandVideoURN atPosition:nil withPreferredSettings:nil];
+    
+    [self waitForExpectationsWithTimeout:30. handler:nil];
+    
+    // Playback resumes where it was parked
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller1 handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [self.controller2 reset];
+    
+    [self waitForExpectationsWithTimeout:30. handler:nil];
+    
+    XCTAssertGreaterThan(CMTimeGetSeconds(self.controller1.currentTime), 32.);
+    
+    // The start position used for restarts is unchanged
+    XCTAssertEqual(CMTimeGetSeconds(self.controller1.startPosition.time), 30.);
+}
+
+- (void)testPlayWithInsufficientPriority
+{
+    SRGLetterboxController.maximumActivePlayerCount = 1;
+    
+    self.controller1.priority = SRGLetterboxControllerPriorityHigh;
+    self.controller2.priority = SRGLetterboxControllerPriorityLow;
+    
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller1 handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    [self keyValueObservingExpectationForObject:self.controller2 keyPath:@"parked" expectedValue:@YES];
+    
+    [self.controller1 playURN:OnDemandVideoURN atPosition:nil withPreferredSettings:nil];
+    [self.controller2 playURN:OnDemandLongVideoURN atPosition:nil withPreferredSettings:nil];
+    
+    [self waitForExpectationsWithTimeout:30. handler:nil];
+    
+    [self.controller2 play];
+    XCTAssertTrue(self.controller2.parked);
+    
+    // Raising the priority promotes the controller
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller2 handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    [self keyValueObservingExpectationForObject:self.controller1 keyPath:@"parked" expectedValue:@YES];
+    
+    self.controller2.priority = SRGLetterboxControllerPriorityHigh + 1.f;
+    
+    [self waitForExpectationsWithTimeout:30. handler:nil];
+}
+
+@end
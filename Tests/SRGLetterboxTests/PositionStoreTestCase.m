@@ -0,0 +1,145 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "LetterboxBaseTestCase.h"
+
+@import SRGLetterbox;
+
+@interface PositionStoreTestCase : LetterboxBaseTestCase
+
+@property (nonatomic) NSURL *fileURL;
+
+@end
+
+@implementation PositionStoreTestCase
+
+#pragma mark Setup and tear down
+
+- (void)setUp
+{
+    self.fileURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:NSUUID.UUID.UUIDString]];
+}
+
+- (void)tearDown
+{
+    [NSFileManager.defaultManager removeItemAtURL:self.fileURL error:NULL];
+    self.fileURL = nil;
+}
+
+#pragma mark Tests
+
+- (void)testSaveAndRemove
+{
+    SRGLetterboxPositionStore *store = [[SRGLetterboxPositionStore alloc] initWithFileURL:self.fileURL];
+    XCTAssertNil([store positionForURN:OnDemandVideoURN]);
+    
+    [store saveTime:CMTimeMakeWithSeconds(12., NSEC_PER_SEC) forURN:OnDemandVideoURN];
+    XCTAssertEqual(CMTimeGetSeconds([store positionForURN:OnDemandVideoURN].time), 12.);
+    
+    [store saveTime:kCMTimeIndefinite forURN:OnDemandVideoURN];
+    XCTAssertEqual(CMTimeGetSeconds([store positionForURN:OnDemandVideoURN].time), 12.);
+    
+    [store removePositionForURN:OnDemandVideoURN];
+    XCTAssertNil([store positionForURN:OnDemandVideoURN]);
+}
+
+- (void)testPersistence
+{
+    SRGLetterboxPositionStore *store1 = [[SRGLetterboxPositionStore alloc] initWithFileURL:self.fileURL];
+    [store1 saveTime:CMTimeMakeWithSeconds(12., NSEC_PER_SEC) forURN:OnDemandVideoURN];
+    [store1 saveTime:CMTimeMakeWithSeconds(34., NSEC_PER_SEC) forURN:OnDemandVideoURN];
+    [store1 saveTime:CMTimeMakeWithSeconds(56., NSEC_PER_SEC) forURN:OnDemandLongVideoURN];
+    [store1 removePositionForURN:OnDemandLongVideoURN];
+    [store1 saveTime:CMTimeMakeWithSeconds(78., NSEC_PER_SEC) forURN:OnDemandAudioWithChaptersURN];
+    [store1 synchronize];
+    
+    SRGLetterboxPositionStore *store2 = [[SRGLetterboxPositionStore alloc] initWithFileURL:self.fileURL];
+    XCTAssertEqual(CMTimeGetSeconds([store2 positionForURN:OnDemandVideoURN].time), 34.);
+    XCTAssertNil([store2 positionForURN:OnDemandLongVideoURN]);
+    XCTAssertEqual(CMTimeGetSeconds([store2 positionForURN:OnDemandAudioWithChaptersURN].time), 78.);
+    
+    [store2 removeAllPositions];
+    [store2 synchronize];
+    
+    SRGLetterboxPositionStore *store3 = [[SRGLetterboxPositionStore alloc] initWithFileURL:self.fileURL];
+    XCTAssertNil([store3 positionForURN:OnDemandVideoURN]);
+    XCTAssertNil([store3 positionForURN:OnDemandAudioWithChaptersURN]);
+}
+
+- (void)testControllerIntegration
+{
+    SRGLetterboxPositionStore *store = [[SRGLetterboxPositionStore alloc] initWithFileURL:self.fileURL];
+    
+    SRGLetterboxController *controller1 = [[SRGLetterboxController alloc] init];
+    controller1.positionStore = store;
+    
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:controller1 handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [controller1 playURN:OnDemandLongVideoURN atPosition:[SRGPosition positionAtTimeInSeconds:30.] withPreferredSettings:nil];
+    
+    [self waitForExpectationsWithTimeout:20. handler:nil];
+    
+    // The position is saved when pausing
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:controller1 handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePaused;
+    }];
+    
+    [controller1 pause];
+    
+    [self waitForExpectationsWithTimeout:20. handler:nil];
+    
+    NSTimeInterval time = CMTimeGetSeconds(controller1.currentTime);
+    XCTAssertEqualWithAccuracy(CMTimeGetSeconds([store positionForURN:OnDemandLongVideoURN].time), time, 1.);
+    
+    [controller1 reset];
+    
+    // Playback resumes at the saved position if none is specified
+    SRGLetterboxController *controller2 = [[SRGLetterboxController alloc] init];
+    controller2.positionStore = store;
+    
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:controller2 handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [controller2 playURN:OnDemandLongVideoURN atPosition:nil withPreferredSettings:nil];
+    
+    [self waitForExpectationsWithTimeout:20. handler:nil];
+    
+    XCTAssertEqualWithAccuracy(CMTimeGetSeconds(controller2.currentTime), time, 3.);
+    
+    // The position is removed when playback ends
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:controller2 handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStateEnded;
+    }];
+    
+    CMTime endTime = CMTimeSubtract(CMTimeRangeGetEnd(controller2.timeRange), CMTimeMakeWithSeconds(3., NSEC_PER_SEC));
+    [controller2 seekToPosition:[SRGPosition positionAtTime:endTime] withCompletionHandler:nil];
+    
+    [self waitForExpectationsWithTimeout:20. handler:nil];
+    
+    XCTAssertNil([store positionForURN:OnDemandLongVideoURN]);
+    
+    [controller2 reset];
+}
+
+- (void)testCompaction
+{
+    SRGLetterboxPositionStore *store1 = [[SRGLetterboxPositionStore alloc] initWithFileURL:self.fileURL];
+    for (NSInteger i = 0; i < 10000; ++i) {
+        [store1 saveTime:CMTimeMakeWithSeconds(i, NSEC_PER_SEC) forURN:OnDemandVideoURN];
+    }
+    [store1 synchronize];
+    
+    NSDictionary<NSFileAttributeKey, id> *attributes = [NSFileManager.defaultManager attributesOfItemAtPath:self.fileURL.path error:NULL];
+    XCTAssertLessThan([attributes[NSFileSize] unsignedLongLongValue], 1024);
+    
+    SRGLetterboxPositionStore *store2 = [[SRGLetterboxPositionStore alloc] initWithFileURL:self.fileURL];
+    XCTAssertEqual(CMTimeGetSeconds([store2 positionForURN:OnDemandVideoURN].time), 9999.);
+}
+
+@end
@@ -0,0 +1 @@
+../../../Sources/SRGLetterbox/SRGLetterboxHedgedMediaCompositionRequest.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../Sources/SRGLetterbox/SRGLetterboxMediaCompositionPreloader.h
\ No newline at end of file
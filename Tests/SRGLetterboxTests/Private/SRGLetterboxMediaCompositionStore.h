@@ -0,0 +1 @@
+../../../Sources/SRGLetterbox/SRGLetterboxMediaCompositionStore.h
\ No newline at end of file
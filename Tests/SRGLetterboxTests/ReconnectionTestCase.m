@@ -0,0 +1,111 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "LetterboxBaseTestCase.h"
+
+@import SRGLetterbox;
+
+// Internals required for testing
+@interface SRGLetterboxController (ReconnectionTestCase)
+
+@property (nonatomic) NSUInteger reconnectionCount;
+
+- (NSTimeInterval)nextReconnectionDelay;
+
+@end
+
+@interface ReconnectionTestCase : LetterboxBaseTestCase
+
+@property (nonatomic) SRGLetterboxController *controller;
+
+@end
+
+@implementation ReconnectionTestCase
+
+#pragma mark Setup and tear down
+
+- (void)setUp
+{
+    self.controller = [[SRGLetterboxController alloc] init];
+}
+
+- (void)tearDown
+{
+    // Always ensure the player gets deallocated between tests
+    [self.controller reset];
+    self.controller = nil;
+}
+
+#pragma mark Tests
+
+- (void)testDefaultValues
+{
+    XCTAssertEqual(self.controller.reconnectionDelay, SRGLetterboxDefaultReconnectionDelay);
+    XCTAssertEqual(self.controller.maximumReconnectionDelay, SRGLetterboxDefaultMaximumReconnectionDelay);
+    XCTAssertEqual(self.controller.reconnectionCount, 0);
+}
+
+- (void)testBackoffBounds
+{
+    self.controller.priority = SRGLetterboxControllerPriorityHigh;
+    self.controller.reconnectionDelay = 1.;
+    self.controller.maximumReconnectionDelay = 30.;
+    
+    for (NSUInteger count = 0; count < 20; ++count) {
+        self.controller.reconnectionCount = count;
+        
+        // Delays are randomly chosen between half and the full expected delay
+        NSTimeInterval expectedDelay = fmin(pow(2., count), 30.);
+        for (NSInteger i = 0; i < 100; ++i) {
+            NSTimeInterval delay = [self.controller nextReconnectionDelay];
+            XCTAssertGreaterThanOrEqual(delay, expectedDelay / 2.);
+            XCTAssertLessThanOrEqual(delay, expectedDelay);
+        }
+    }
+}
+
+- (void)testBackoffForLowerPriorities
+{
+    self.controller.reconnectionDelay = 1.;
+    self.controller.maximumReconnectionDelay = 30.;
+    
+    // One additional initial delay per priority step below the high priority
+    self.controller.priority = SRGLetterboxControllerPriorityLow;
+    for (NSInteger i = 0; i < 100; ++i) {
+        NSTimeInterval delay = [self.controller nextReconnectionDelay];
+        XCTAssertGreaterThanOrEqual(delay, 2.5);
+        XCTAssertLessThanOrEqual(delay, 3.);
+    }
+}
+
+- (void)testDisabledReconnectionDelay
+{
+    self.controller.reconnectionDelay = 0.;
+    self.controller.reconnectionCount = 5;
+    XCTAssertEqual([self.controller nextReconnectionDelay], 0.);
+}
+
+- (void)testBackoffResetAfterPlayback
+{
+    self.controller.priority = SRGLetterboxControllerPriorityHigh;
+    self.controller.reconnectionCount = 5;
+    
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [self.controller playURN:OnDemandVideoURN atPosition:nil withPreferredSettings:nil];
+    
+    [self waitForExpectationsWithTimeout:20. handler:nil];
+    
+    XCTAssertEqual(self.controller.reconnectionCount, 0);
+    
+    NSTimeInterval delay = [self.controller nextReconnectionDelay];
+    XCTAssertGreaterThanOrEqual(delay, self.controller.reconnectionDelay / 2.);
+    XCTAssertLessThanOrEqual(delay, self.controller.reconnectionDelay);
+}
+
+@end
@@ -0,0 +1,146 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "LetterboxBaseTestCase.h"
+
+@import OHHTTPStubs;
+@import SRGLetterbox;
+
+// Imports required to test internals
+#import "SRGLetterboxController+Private.h"
+
+// Internals required for testing
+@interface SRGLetterboxController (RetryTestCase)
+
+@property (nonatomic, readonly) SRGPosition *startPosition;
+
+@end
+
+@interface RetryTestCase : LetterboxBaseTestCase
+
+@property (nonatomic) SRGLetterboxController *controller;
+
+@end
+
+@implementation RetryTestCase
+
+#pragma mark Setup and tear down
+
+- (void)setUp
+{
+    self.controller = [[SRGLetterboxController alloc] init];
+}
+
+- (void)tearDown
+{
+    // Always ensure the player gets deallocated between tests
+    [self.controller reset];
+    self.controller = nil;
+}
+
+#pragma mark Helpers
+
+// Simulate a player failure with the specified error
+- (void)failPlaybackWithError:(NSError *)error
+{
+    [self expectationForSingleNotification:SRGLetterboxPlaybackDidFailNotification object:self.controller handler:nil];
+    
+    [NSNotificationCenter.defaultCenter postNotificationName:SRGMediaPlayerPlaybackDidFailNotification
+                                                      object:self.controller.mediaPlayerController
+                                                    userInfo:@{ SRGMediaPlayerErrorKey : error }];
+    
+    [self waitForExpectationsWithTimeout:10. handler:nil];
+}
+
+#pragma mark Tests
+
+- (void)testRetryAfterTransientNetworkError
+{
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [self.controller playURN:OnDemandLongVideoURN atPosition:[SRGPosition positionAtTimeInSeconds:30.] withPreferredSettings:nil];
+    
+    [self waitForExpectationsWithTimeout:20. handler:nil];
+    
+    // Let playback run so that the playback position is recorded
+    [self expectationForElapsedTimeInterval:3. withHandler:nil];
+    
+    [self waitForExpectationsWithTimeout:20. handler:nil];
+    
+    NSTimeInterval time = CMTimeGetSeconds(self.controller.currentTime);
+    SRGMediaComposition *mediaComposition = self.controller.mediaComposition;
+    XCTAssertNotNil(mediaComposition);
+    
+    // Any media composition request made from now on fails
+    __block NSInteger mediaCompositionRequestCount = 0;
+    id<HTTPStubsDescriptor> mediaCompositionRequestStub = [HTTPStubs stubRequestsPassingTest:^BOOL(NSURLRequest *request) {
+        return [request.URL.absoluteString containsString:@"mediaComposition"];
+    } withStubResponse:^HTTPStubsResponse *(NSURLRequest *request) {
+        @synchronized(self) {
+            mediaCompositionRequestCount += 1;
+        }
+        return [HTTPStubsResponse responseWithError:[NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorNotConnectedToInternet userInfo:nil]];
+    }];
+    mediaCompositionRequestStub.name = @"Unavailable media composition";
+    
+    [self failPlaybackWithError:[NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorNetworkConnectionLost userInfo:nil]];
+    XCTAssertNotNil(self.controller.error);
+    
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [self.controller retry];
+    
+    [self waitForExpectationsWithTimeout:20. handler:^(NSError * _Nullable error) {
+        [HTTPStubs removeStub:mediaCompositionRequestStub];
+    }];
+    
+    // Playback resumed where it was left, with the same metadata
+    XCTAssertNil(self.controller.error);
+    XCTAssertEqual(self.controller.mediaComposition, mediaComposition);
+    XCTAssertEqual(self.controller.dataAvailability, SRGLetterboxDataAvailabilityLoaded);
+    XCTAssertEqualWithAccuracy(CMTimeGetSeconds(self.controller.currentTime), time, 3.);
+    
+    // The initial start position is kept for later restarts
+    XCTAssertEqual(CMTimeGetSeconds(self.controller.startPosition.time), 30.);
+    
+    @synchronized(self) {
+        XCTAssertEqual(mediaCompositionRequestCount, 0);
+    }
+}
+
+- (void)testRetryAfterNonTransientError
+{
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [self.controller playURN:OnDemandVideoURN atPosition:nil withPreferredSettings:nil];
+    
+    [self waitForExpectationsWithTimeout:20. handler:nil];
+    
+    SRGMediaComposition *mediaComposition = self.controller.mediaComposition;
+    XCTAssertNotNil(mediaComposition);
+    
+    [self failPlaybackWithError:[NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorBadServerResponse userInfo:nil]];
+    
+    // Metadata is retrieved again
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [self.controller retry];
+    
+    [self waitForExpectationsWithTimeout:20. handler:nil];
+    
+    XCTAssertNotNil(self.controller.mediaComposition);
+    XCTAssertNotEqual(self.controller.mediaComposition, mediaComposition);
+}
+
+@end
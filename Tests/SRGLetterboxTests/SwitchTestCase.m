@@ -7,6 +7,7 @@
 #import "LetterboxBaseTestCase.h"
 #import "TrackerSingletonSetup.h"
 
+@import OHHTTPStubs;
 @import SRGDataProviderNetwork;
 @import SRGLetterbox;
 
@@ -111,6 +112,90 @@
     }];
 }
 
+- (void)testSwitchToChapterURNDeliveredWithTheSameStream
+{
+    // Alter the media composition so that other chapters are delivered with the stream of the main chapter, starting at
+    // 30 seconds
+    static NSString * const kPassthroughHeaderField = @"X-Letterbox-Test-Passthrough";
+    static const NSTimeInterval kChapterMarkIn = 30.;
+    
+    id<HTTPStubsDescriptor> mediaCompositionRequestStub = [HTTPStubs stubRequestsPassingTest:^BOOL(NSURLRequest *request) {
+        return [request.URL.absoluteString containsString:@"mediaComposition"] && [request.URL.absoluteString containsString:@"5fe1618a-b710-42aa-ac8a-cb9eabf42426"]
+            && ! [request valueForHTTPHeaderField:kPassthroughHeaderField];
+    } withStubResponse:^HTTPStubsResponse *(NSURLRequest *request) {
+        NSMutableURLRequest *passthroughRequest = request.mutableCopy;
+        [passthroughRequest setValue:@"1" forHTTPHeaderField:kPassthroughHeaderField];
+        
+        __block NSData *data = nil;
+        dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+        [[NSURLSession.sharedSession dataTaskWithRequest:passthroughRequest completionHandler:^(NSData * _Nullable responseData, NSURLResponse * _Nullable response, NSError * _Nullable error) {
+            data = responseData;
+            dispatch_semaphore_signal(semaphore);
+        }] resume];
+        dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+        
+        NSMutableDictionary *JSONDictionary = data ? [NSJSONSerialization JSONObjectWithData:data options:NSJSONReadingMutableContainers error:NULL] : nil;
+        NSArray<NSMutableDictionary *> *chapterDictionaries = JSONDictionary[@"chapterList"];
+        NSPredicate *predicate = [NSPredicate predicateWithFormat:@"urn == %@", JSONDictionary[@"chapterUrn"]];
+        NSMutableDictionary *mainChapterDictionary = [chapterDictionaries filteredArrayUsingPredicate:predicate].firstObject;
+        for (NSMutableDictionary *chapterDictionary in chapterDictionaries) {
+            if (chapterDictionary == mainChapterDictionary) {
+                continue;
+            }
+            
+            chapterDictionary[@"resourceList"] = mainChapterDictionary[@"resourceList"];
+            chapterDictionary[@"markIn"] = @(kChapterMarkIn * 1000.);
+            chapterDictionary[@"markOut"] = @(2. * kChapterMarkIn * 1000.);
+            [chapterDictionary removeObjectForKey:@"blockReason"];
+        }
+        
+        return [HTTPStubsResponse responseWithData:[NSJSONSerialization dataWithJSONObject:JSONDictionary ?: @{} options:0 error:NULL]
+                                        statusCode:200
+                                           headers:@{ @"Content-Type" : @"application/json" }];
+    }];
+    mediaCompositionRequestStub.name = @"Chapters delivered with the same stream";
+    
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [self.controller playURN:OnDemandLongVideoSegmentURN atPosition:nil withPreferredSettings:nil];
+    
+    [self waitForExpectationsWithTimeout:10. handler:nil];
+    
+    NSString *mainChapterURN = self.controller.mediaComposition.mainChapter.URN;
+    NSPredicate *predicate = [NSPredicate predicateWithFormat:@"URN != %@", mainChapterURN];
+    SRGChapter *chapter = [self.controller.mediaComposition.chapters filteredArrayUsingPredicate:predicate].firstObject;
+    XCTAssertNotNil(chapter);
+    
+    // The player must not be stopped
+    id playbackStateObserver = [NSNotificationCenter.defaultCenter addObserverForName:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller queue:nil usingBlock:^(NSNotification * _Nonnull notification) {
+        SRGMediaPlayerPlaybackState playbackState = [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue];
+        if (playbackState == SRGMediaPlayerPlaybackStateIdle || playbackState == SRGMediaPlayerPlaybackStatePreparing) {
+            XCTFail(@"The player must not be stopped");
+        }
+    }];
+    
+    XCTestExpectation *completionHandlerExpectation = [self expectationWithDescription:@"Completion handler"];
+    BOOL switched = [self.controller switchToURN:chapter.URN withCompletionHandler:^(BOOL finished) {
+        XCTAssertTrue(finished);
+        [completionHandlerExpectation fulfill];
+    }];
+    XCTAssertTrue(switched);
+    
+    // Metadata is updated in place
+    XCTAssertEqualObjects(self.controller.subdivision.URN, chapter.URN);
+    XCTAssertEqualObjects(self.controller.mediaComposition.mainChapter.URN, chapter.URN);
+    XCTAssertEqualObjects(self.controller.media.URN, chapter.URN);
+    
+    [self waitForExpectationsWithTimeout:10. handler:^(NSError * _Nullable error) {
+        [NSNotificationCenter.defaultCenter removeObserver:playbackStateObserver];
+        [HTTPStubs removeStub:mediaCompositionRequestStub];
+    }];
+    
+    XCTAssertEqualWithAccuracy(CMTimeGetSeconds(self.controller.currentTime), kChapterMarkIn, 2.);
+}
+
 - (void)testSwitchToUnrelatedURN
 {
     [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller handler:^BOOL(NSNotification * _Nonnull notification) {
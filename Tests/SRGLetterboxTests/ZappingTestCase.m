@@ -0,0 +1,96 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "LetterboxBaseTestCase.h"
+
+@import SRGLetterbox;
+
+@interface ZappingTestCase : LetterboxBaseTestCase
+
+@property (nonatomic) SRGLetterboxController *controller;
+
+@end
+
+@implementation ZappingTestCase
+
+#pragma mark Setup and tear down
+
+- (void)setUp
+{
+    self.controller = [[SRGLetterboxController alloc] init];
+}
+
+- (void)tearDown
+{
+    [self.controller reset];
+    self.controller = nil;
+}
+
+#pragma mark Tests
+
+- (void)testWithoutZappingURNs
+{
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [self.controller playURN:LiveVideoURN atPosition:nil withPreferredSettings:nil];
+    
+    [self waitForExpectationsWithTimeout:30. handler:nil];
+    
+    XCTAssertNil(self.controller.previousZappingURN);
+    XCTAssertNil(self.controller.nextZappingURN);
+    XCTAssertFalse([self.controller zapToNextChannel]);
+    XCTAssertFalse([self.controller zapToPreviousChannel]);
+}
+
+- (void)testMediaOutsideZappingURNs
+{
+    self.controller.zappingURNs = @[ LiveVideoURN, LiveAudioURN ];
+    
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [self.controller playURN:OnDemandVideoURN atPosition:nil withPreferredSettings:nil];
+    
+    [self waitForExpectationsWithTimeout:30. handler:nil];
+    
+    XCTAssertNil(self.controller.previousZappingURN);
+    XCTAssertNil(self.controller.nextZappingURN);
+    XCTAssertFalse([self.controller zapToNextChannel]);
+}
+
+- (void)testZapping
+{
+    self.controller.zappingURNs = @[ LiveVideoURN, LiveAudioURN, OnDemandVideoURN ];
+    
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    [self.controller playURN:LiveVideoURN atPosition:nil withPreferredSettings:nil];
+    
+    [self waitForExpectationsWithTimeout:30. handler:nil];
+    
+    // The list is circular
+    XCTAssertEqualObjects(self.controller.previousZappingURN, OnDemandVideoURN);
+    XCTAssertEqualObjects(self.controller.nextZappingURN, LiveAudioURN);
+    
+    [self expectationForSingleNotification:SRGLetterboxPlaybackStateDidChangeNotification object:self.controller handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+    
+    XCTAssertTrue([self.controller zapToNextChannel]);
+    
+    [self waitForExpectationsWithTimeout:30. handler:nil];
+    
+    XCTAssertEqualObjects(self.controller.URN, LiveAudioURN);
+    XCTAssertEqualObjects(self.controller.previousZappingURN, LiveVideoURN);
+    XCTAssertEqualObjects(self.controller.nextZappingURN, OnDemandVideoURN);
+}
+
+@end